@@ -0,0 +1,32 @@
+﻿#include "ProtoBridgeBenchmarkCommandlet.h"
+#include "ProtoBridgeBenchmarkSuite.h"
+#include "Misc/Parse.h"
+
+UProtoBridgeBenchmarkCommandlet::UProtoBridgeBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UProtoBridgeBenchmarkCommandlet::Main(const FString& Params)
+{
+	FProtoBridgeBenchmarkOptions Options;
+	FParse::Value(*Params, TEXT("Iterations="), Options.Iterations);
+	FParse::Value(*Params, TEXT("CollectionSize="), Options.CollectionSize);
+	FParse::Value(*Params, TEXT("Schema="), Options.Schema);
+	FParse::Value(*Params, TEXT("Codec="), Options.Codec);
+	Options.Iterations = FMath::Max(1, Options.Iterations);
+	Options.CollectionSize = FMath::Max(1, Options.CollectionSize);
+
+	FString OutputPath = FProtoBridgeBenchmarkSuite::GetDefaultOutputPath();
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	TArray<FProtoBridgeBenchmarkResult> Results;
+	if (!FProtoBridgeBenchmarkSuite::Run(Options, Results))
+	{
+		return 1;
+	}
+	return FProtoBridgeBenchmarkSuite::WriteJson(Options, Results, OutputPath) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,509 @@
+﻿#include "ProtoBridgeBenchmarkSuite.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Serialization/JsonWriter.h"
+
+#if WITH_PROTOBRIDGE_BENCHMARK_SCHEMAS
+#include "CodecBenchmark.ue.h"
+#include "CodecBenchmarkArena.ue.h"
+#include "ProtobufIncludes.h"
+#include "JsonObjectConverter.h"
+#include "Math/RandomStream.h"
+#include "Misc/StringBuilder.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogProtoBridgeBenchmarks, Log, All);
+
+namespace
+{
+	const TCHAR* const CodecNames[] = { TEXT("ProtoBridge"), TEXT("ProtoBridgeArena"), TEXT("ProtoBridgeJson"), TEXT("TaggedProperties"), TEXT("FJsonObjectConverter") };
+}
+
+#if WITH_PROTOBRIDGE_BENCHMARK_SCHEMAS
+
+namespace
+{
+#if STATS
+	/** FMalloc's call counters are protected; the engine allocators bump them for every thread, so the count is process-wide. */
+	struct FAllocationCounter : public FMalloc
+	{
+		static uint64 Get()
+		{
+			return TotalMallocCalls.load(std::memory_order_relaxed) + TotalReallocCalls.load(std::memory_order_relaxed);
+		}
+	};
+#endif
+
+	class FBenchmarkRunner
+	{
+	public:
+		FBenchmarkRunner(const FProtoBridgeBenchmarkOptions& InOptions, TArray<FProtoBridgeBenchmarkResult>& InResults)
+			: Options(InOptions)
+			, Results(InResults)
+		{
+		}
+
+		bool IsCodecSelected(const TCHAR* Codec) const
+		{
+			return Options.Codec.IsEmpty() || Options.Codec.Equals(Codec, ESearchCase::IgnoreCase);
+		}
+
+		/** Times Iterations calls of Body after one warm-up call; Bytes is the payload size one call produces or consumes. */
+		template <typename FuncType>
+		bool Measure(const TCHAR* Schema, const TCHAR* Codec, const TCHAR* Operation, int64 Bytes, FuncType&& Body)
+		{
+			TRACE_BOOKMARK(TEXT("ProtoBridge.Benchmark %s %s %s"), Schema, Codec, Operation);
+			if (!Body())
+			{
+				UE_LOG(LogProtoBridgeBenchmarks, Error, TEXT("%s: %s %s failed"), Schema, Codec, Operation);
+				return false;
+			}
+
+#if STATS
+			const uint64 StartAllocations = FAllocationCounter::Get();
+#endif
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < Options.Iterations; ++Iteration)
+			{
+				Body();
+			}
+			const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+#if STATS
+			const double AllocationsPerOp = static_cast<double>(FAllocationCounter::Get() - StartAllocations) / Options.Iterations;
+#else
+			const double AllocationsPerOp = -1.0;
+#endif
+
+			FProtoBridgeBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+			Result.Schema = Schema;
+			Result.Codec = Codec;
+			Result.Operation = Operation;
+			Result.BytesPerOp = Bytes;
+			Result.NsPerOp = Seconds * 1.0e9 / Options.Iterations;
+			Result.MegabytesPerSecond = Seconds > 0.0 ? static_cast<double>(Bytes) * Options.Iterations / Seconds / (1024.0 * 1024.0) : 0.0;
+			Result.AllocationsPerOp = AllocationsPerOp;
+
+			UE_LOG(LogProtoBridgeBenchmarks, Display, TEXT("%-16s %-22s %-10s %8lld B %12.1f ns/op %10.1f MB/s %8.1f allocs/op"),
+				Schema, Codec, Operation, Bytes, Result.NsPerOp, Result.MegabytesPerSecond, Result.AllocationsPerOp);
+			return true;
+		}
+
+		/** ArenaType is the same message generated from the ProtoBridgeBenchArena copy with the arena option. */
+		template <typename UeType, typename ProtoType, typename ArenaType, typename DecodeFuncType, typename DecodeArenaFuncType>
+		bool RunSchema(const TCHAR* Schema, const UeType& Value, DecodeFuncType&& Decode, DecodeArenaFuncType&& DecodeArena)
+		{
+			bool bSuccess = true;
+			UeType Decoded;
+
+			if (IsCodecSelected(TEXT("ProtoBridge")))
+			{
+				TArray<uint8> Bytes;
+				UCodecBenchmarkProtoLibrary::EncodeAppend(Value, Bytes);
+				bSuccess &= Measure(Schema, TEXT("ProtoBridge"), TEXT("Encode"), Bytes.Num(), [&Value, &Bytes]()
+				{
+					Bytes.Reset();
+					return UCodecBenchmarkProtoLibrary::EncodeAppend(Value, Bytes);
+				});
+				bSuccess &= Measure(Schema, TEXT("ProtoBridge"), TEXT("Decode"), Bytes.Num(), [&Bytes, &Decoded, &Decode]()
+				{
+					return Decode(Bytes, Decoded);
+				});
+			}
+
+			if (IsCodecSelected(TEXT("ProtoBridgeArena")))
+			{
+				TArray<uint8> Bytes;
+				UCodecBenchmarkProtoLibrary::EncodeAppend(Value, Bytes);
+				ArenaType ArenaValue;
+				ArenaType ArenaDecoded;
+				if (!DecodeArena(Bytes, ArenaValue))
+				{
+					UE_LOG(LogProtoBridgeBenchmarks, Error, TEXT("%s: ProtoBridgeArena could not decode the heap encoding"), Schema);
+					bSuccess = false;
+				}
+				else
+				{
+					bSuccess &= Measure(Schema, TEXT("ProtoBridgeArena"), TEXT("Encode"), Bytes.Num(), [&ArenaValue, &Bytes]()
+					{
+						Bytes.Reset();
+						return UCodecBenchmarkArenaProtoLibrary::EncodeAppend(ArenaValue, Bytes);
+					});
+					bSuccess &= Measure(Schema, TEXT("ProtoBridgeArena"), TEXT("Decode"), Bytes.Num(), [&Bytes, &ArenaDecoded, &DecodeArena]()
+					{
+						return DecodeArena(Bytes, ArenaDecoded);
+					});
+				}
+			}
+
+			if (IsCodecSelected(TEXT("ProtoBridgeJson")))
+			{
+				std::string Json;
+				ProtoType JsonProto;
+				Value.ToProto(JsonProto);
+				google::protobuf::util::MessageToJsonString(JsonProto, &Json);
+				bSuccess &= Measure(Schema, TEXT("ProtoBridgeJson"), TEXT("Encode"), static_cast<int64>(Json.size()), [&Value, &Json]()
+				{
+					ProtoType Proto;
+					Value.ToProto(Proto);
+					Json.clear();
+					return google::protobuf::util::MessageToJsonString(Proto, &Json).ok();
+				});
+				bSuccess &= Measure(Schema, TEXT("ProtoBridgeJson"), TEXT("Decode"), static_cast<int64>(Json.size()), [&Json, &Decoded]()
+				{
+					ProtoType Proto;
+					if (!google::protobuf::util::JsonStringToMessage(Json, &Proto).ok())
+					{
+						return false;
+					}
+					Decoded.FromProto(Proto);
+					return true;
+				});
+			}
+
+			UScriptStruct* Struct = UeType::StaticStruct();
+
+			if (IsCodecSelected(TEXT("TaggedProperties")))
+			{
+				TArray<uint8> TaggedBytes;
+				auto WriteTagged = [Struct, &Value, &TaggedBytes]()
+				{
+					TaggedBytes.Reset();
+					FMemoryWriter Writer(TaggedBytes);
+					FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+					Struct->SerializeItem(Ar, const_cast<UeType*>(&Value), nullptr);
+					return !Ar.IsError();
+				};
+				WriteTagged();
+				bSuccess &= Measure(Schema, TEXT("TaggedProperties"), TEXT("Encode"), TaggedBytes.Num(), WriteTagged);
+				bSuccess &= Measure(Schema, TEXT("TaggedProperties"), TEXT("Decode"), TaggedBytes.Num(), [Struct, &TaggedBytes, &Decoded]()
+				{
+					FMemoryReader Reader(TaggedBytes);
+					FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+					Struct->SerializeItem(Ar, &Decoded, nullptr);
+					return !Ar.IsError();
+				});
+			}
+
+			if (IsCodecSelected(TEXT("FJsonObjectConverter")))
+			{
+				FString ConverterJson;
+				FJsonObjectConverter::UStructToJsonObjectString(Struct, &Value, ConverterJson, 0, 0, 0, nullptr, false);
+				const int64 ConverterBytes = FTCHARToUTF8(*ConverterJson, ConverterJson.Len()).Length();
+				bSuccess &= Measure(Schema, TEXT("FJsonObjectConverter"), TEXT("Encode"), ConverterBytes, [Struct, &Value, &ConverterJson]()
+				{
+					ConverterJson.Reset();
+					return FJsonObjectConverter::UStructToJsonObjectString(Struct, &Value, ConverterJson, 0, 0, 0, nullptr, false);
+				});
+				bSuccess &= Measure(Schema, TEXT("FJsonObjectConverter"), TEXT("Decode"), ConverterBytes, [Struct, &ConverterJson, &Decoded]()
+				{
+					return FJsonObjectConverter::JsonObjectStringToUStruct(ConverterJson, Struct, &Decoded, 0, 0);
+				});
+			}
+
+			return bSuccess;
+		}
+
+	private:
+		const FProtoBridgeBenchmarkOptions& Options;
+		TArray<FProtoBridgeBenchmarkResult>& Results;
+	};
+
+	FString MakeText(FRandomStream& Random, int32 Words)
+	{
+		static const TCHAR* Vocabulary[] = { TEXT("alpha"), TEXT("bravo"), TEXT("ctrl"), TEXT("delta"), TEXT("echo"), TEXT("foxtrot"), TEXT("Ünïcødé"), TEXT("gamma") };
+		TStringBuilder<256> Builder;
+		for (int32 Word = 0; Word < Words; ++Word)
+		{
+			Builder << (Word > 0 ? TEXT(" ") : TEXT("")) << Vocabulary[Random.RandHelper(static_cast<int32>(UE_ARRAY_COUNT(Vocabulary)))];
+		}
+		return Builder.ToString();
+	}
+
+	FProtoBridgeBench_FlatScalars MakeFlatScalars(FRandomStream& Random)
+	{
+		FProtoBridgeBench_FlatScalars Value;
+		Value.Health = Random.RandRange(0, 100);
+		Value.Score = static_cast<int64>(Random.RandRange(0, MAX_int32)) << 8;
+		Value.Speed = Random.FRandRange(0.0f, 1200.0f);
+		Value.Timestamp = FPlatformTime::Seconds();
+		Value.Alive = Random.FRand() > 0.1f;
+		Value.Delta = Random.RandRange(-500, 500);
+		Value.Team = Random.RandRange(0, 4);
+		Value.OwnerId = static_cast<int64>(Random.RandRange(1, MAX_int32)) * 4099;
+		return Value;
+	}
+
+	FProtoBridgeBench_NestedLevel1 MakeNested(FRandomStream& Random)
+	{
+		FProtoBridgeBench_NestedLevel1 Level1;
+		Level1.Value = Random.RandRange(0, 1000);
+		Level1.Child.Value = Random.RandRange(0, 1000);
+		Level1.Child.Child.Value = Random.RandRange(0, 1000);
+		Level1.Child.Child.Leaf.Value = Random.RandRange(0, 1000);
+		Level1.Child.Child.Leaf.Label = MakeText(Random, 2);
+		return Level1;
+	}
+
+	FProtoBridgeBench_DeepNesting MakeDeepNesting(FRandomStream& Random, int32 CollectionSize)
+	{
+		FProtoBridgeBench_DeepNesting Value;
+		Value.Child = MakeNested(Random);
+		for (int32 Index = 0; Index < CollectionSize / 8; ++Index)
+		{
+			Value.Siblings.Add(MakeNested(Random));
+		}
+		return Value;
+	}
+
+	FProtoBridgeBench_LargeRepeated MakeLargeRepeated(FRandomStream& Random, int32 CollectionSize)
+	{
+		FProtoBridgeBench_LargeRepeated Value;
+		for (int32 Index = 0; Index < CollectionSize * 16; ++Index)
+		{
+			Value.Ids.Add(Random.RandRange(0, MAX_int32));
+			Value.Weights.Add(Random.FRand());
+			Value.Samples.Add(Random.FRandRange(-1.0e6, 1.0e6));
+		}
+		for (int32 Index = 0; Index < CollectionSize; ++Index)
+		{
+			Value.Rows.Add(MakeFlatScalars(Random));
+		}
+		return Value;
+	}
+
+	FProtoBridgeBench_StringHeavy MakeStringHeavy(FRandomStream& Random, int32 CollectionSize)
+	{
+		FProtoBridgeBench_StringHeavy Value;
+		Value.Name = MakeText(Random, 3);
+		Value.Description = MakeText(Random, 64);
+		for (int32 Index = 0; Index < CollectionSize; ++Index)
+		{
+			Value.Tags.Add(MakeText(Random, 1));
+			Value.Lines.Add(MakeText(Random, 12));
+		}
+		return Value;
+	}
+
+	FProtoBridgeBench_Maps MakeMaps(FRandomStream& Random, int32 CollectionSize)
+	{
+		FProtoBridgeBench_Maps Value;
+		for (int32 Index = 0; Index < CollectionSize; ++Index)
+		{
+			const FString Key = FString::Printf(TEXT("key_%d"), Index);
+			Value.Counters.Add(Key, Random.RandRange(0, 10000));
+			Value.Labels.Add(Index, MakeText(Random, 2));
+			Value.Weights.Add(Key, Random.FRandRange(0.0, 1.0));
+		}
+		return Value;
+	}
+
+	FProtoBridgeBench_DynamicPayload MakeDynamicPayload(FRandomStream& Random, int32 CollectionSize)
+	{
+		FProtoBridgeBench_DynamicPayload Value;
+		Value.Attributes = MakeShared<FJsonObject>();
+		for (int32 Index = 0; Index < CollectionSize; ++Index)
+		{
+			TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+			Entry->SetStringField(TEXT("name"), MakeText(Random, 2));
+			Entry->SetNumberField(TEXT("score"), Random.FRandRange(-1000.0, 1000.0));
+			Entry->SetBoolField(TEXT("active"), Random.FRand() > 0.5f);
+			Value.Attributes->SetObjectField(FString::Printf(TEXT("entry_%d"), Index), Entry);
+		}
+
+		::ProtoBridgeBench::FlatScalars Payload;
+		MakeFlatScalars(Random).ToProto(Payload);
+		Value.Payload.TypeUrl = TEXT("type.googleapis.com/ProtoBridgeBench.FlatScalars");
+		Value.Payload.Value.SetNumUninitialized(static_cast<int32>(Payload.ByteSizeLong()));
+		Payload.SerializeToArray(Value.Payload.Value.GetData(), Value.Payload.Value.Num());
+		return Value;
+	}
+
+	FTransform MakeTransform(FRandomStream& Random)
+	{
+		return FTransform(FRotator(Random.FRandRange(-90.0, 90.0), Random.FRandRange(-180.0, 180.0), 0.0), FVector(Random.VRand() * 1000.0), FVector(1.0));
+	}
+
+	FProtoBridgeBench_MathTypes MakeMathTypes(FRandomStream& Random, int32 CollectionSize)
+	{
+		FProtoBridgeBench_MathTypes Value;
+		Value.Location = Random.VRand() * 5000.0;
+		Value.Rotation = MakeTransform(Random).GetRotation();
+		Value.Transform = MakeTransform(Random);
+		Value.Tint = FLinearColor(Random.FRand(), Random.FRand(), Random.FRand(), 1.0f);
+		Value.CompressedRotation = MakeTransform(Random).GetRotation();
+		for (int32 Index = 0; Index < CollectionSize; ++Index)
+		{
+			Value.Path.Add(Random.VRand() * 5000.0);
+			Value.Bones.Add(MakeTransform(Random));
+		}
+		return Value;
+	}
+}
+
+namespace
+{
+	struct FBenchmarkSchema
+	{
+		const TCHAR* Name;
+		bool (*Run)(FBenchmarkRunner& Runner, FRandomStream& Random, int32 CollectionSize);
+	};
+
+#define PROTOBRIDGE_BENCHMARK_SCHEMA(Name, Value) \
+	{ TEXT(#Name), [](FBenchmarkRunner& Runner, FRandomStream& Random, int32 CollectionSize) \
+		{ \
+			return Runner.RunSchema<FProtoBridgeBench_##Name, ::ProtoBridgeBench::Name, FProtoBridgeBenchArena_##Name>(TEXT(#Name), Value, \
+				[](const TArray<uint8>& InBytes, FProtoBridgeBench_##Name& OutValue) { return UCodecBenchmarkProtoLibrary::DecodeProtoBridgeBench_##Name(InBytes, OutValue); }, \
+				[](const TArray<uint8>& InBytes, FProtoBridgeBenchArena_##Name& OutValue) { return UCodecBenchmarkArenaProtoLibrary::DecodeProtoBridgeBenchArena_##Name(InBytes, OutValue); }); \
+		} }
+
+	const FBenchmarkSchema Schemas[] = {
+		PROTOBRIDGE_BENCHMARK_SCHEMA(FlatScalars, MakeFlatScalars(Random)),
+		PROTOBRIDGE_BENCHMARK_SCHEMA(DeepNesting, MakeDeepNesting(Random, CollectionSize)),
+		PROTOBRIDGE_BENCHMARK_SCHEMA(LargeRepeated, MakeLargeRepeated(Random, CollectionSize)),
+		PROTOBRIDGE_BENCHMARK_SCHEMA(StringHeavy, MakeStringHeavy(Random, CollectionSize)),
+		PROTOBRIDGE_BENCHMARK_SCHEMA(Maps, MakeMaps(Random, CollectionSize)),
+		PROTOBRIDGE_BENCHMARK_SCHEMA(DynamicPayload, MakeDynamicPayload(Random, CollectionSize)),
+		PROTOBRIDGE_BENCHMARK_SCHEMA(MathTypes, MakeMathTypes(Random, CollectionSize))
+	};
+
+#undef PROTOBRIDGE_BENCHMARK_SCHEMA
+}
+
+bool FProtoBridgeBenchmarkSuite::Run(const FProtoBridgeBenchmarkOptions& Options, TArray<FProtoBridgeBenchmarkResult>& OutResults)
+{
+	if (!Options.Schema.IsEmpty() && !GetSchemaNames().Contains(Options.Schema))
+	{
+		UE_LOG(LogProtoBridgeBenchmarks, Error, TEXT("Unknown benchmark schema %s"), *Options.Schema);
+		return false;
+	}
+	if (!Options.Codec.IsEmpty() && !GetCodecNames().Contains(Options.Codec))
+	{
+		UE_LOG(LogProtoBridgeBenchmarks, Error, TEXT("Unknown benchmark codec %s"), *Options.Codec);
+		return false;
+	}
+
+	FBenchmarkRunner Runner(Options, OutResults);
+	bool bSuccess = true;
+	for (const FBenchmarkSchema& Schema : Schemas)
+	{
+		if (Options.Schema.IsEmpty() || Options.Schema.Equals(Schema.Name, ESearchCase::IgnoreCase))
+		{
+			// Seeded per schema so a filtered run measures the same values as the full suite.
+			FRandomStream Random(0x5EED);
+			bSuccess &= Schema.Run(Runner, Random, Options.CollectionSize);
+		}
+	}
+	return bSuccess;
+}
+
+TArray<FString> FProtoBridgeBenchmarkSuite::GetSchemaNames()
+{
+	TArray<FString> Names;
+	for (const FBenchmarkSchema& Schema : Schemas)
+	{
+		Names.Add(Schema.Name);
+	}
+	return Names;
+}
+
+#else
+
+bool FProtoBridgeBenchmarkSuite::Run(const FProtoBridgeBenchmarkOptions& Options, TArray<FProtoBridgeBenchmarkResult>& OutResults)
+{
+	UE_LOG(LogProtoBridgeBenchmarks, Error, TEXT("Benchmark schemas are not generated. Make protoc and bridge_generator available to the plugin pre-build step and rebuild."));
+	return false;
+}
+
+TArray<FString> FProtoBridgeBenchmarkSuite::GetSchemaNames()
+{
+	return TArray<FString>();
+}
+
+#endif
+
+bool FProtoBridgeBenchmarkSuite::WriteJson(const FProtoBridgeBenchmarkOptions& Options, const TArray<FProtoBridgeBenchmarkResult>& Results, const FString& Path)
+{
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("ProtoBridge"));
+
+	FString Json;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("pluginVersion"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString());
+	Writer->WriteValue(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+	Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+	Writer->WriteValue(TEXT("configuration"), FString(LexToString(FApp::GetBuildConfiguration())));
+	Writer->WriteValue(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Writer->WriteValue(TEXT("iterations"), Options.Iterations);
+	Writer->WriteValue(TEXT("collectionSize"), Options.CollectionSize);
+
+	Writer->WriteArrayStart(TEXT("results"));
+	for (const FProtoBridgeBenchmarkResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("schema"), Result.Schema);
+		Writer->WriteValue(TEXT("codec"), Result.Codec);
+		Writer->WriteValue(TEXT("operation"), Result.Operation);
+		Writer->WriteValue(TEXT("bytesPerOp"), Result.BytesPerOp);
+		Writer->WriteValue(TEXT("nsPerOp"), Result.NsPerOp);
+		Writer->WriteValue(TEXT("mbPerSecond"), Result.MegabytesPerSecond);
+		Writer->WriteValue(TEXT("allocationsPerOp"), Result.AllocationsPerOp);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(Json, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogProtoBridgeBenchmarks, Error, TEXT("Failed to write benchmark results to %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogProtoBridgeBenchmarks, Display, TEXT("Benchmark results written to %s"), *Path);
+	return true;
+}
+
+TArray<FString> FProtoBridgeBenchmarkSuite::GetCodecNames()
+{
+	return TArray<FString>(CodecNames, UE_ARRAY_COUNT(CodecNames));
+}
+
+FString FProtoBridgeBenchmarkSuite::GetDefaultOutputPath()
+{
+	return FPaths::Combine(FPaths::ProfilingDir(), TEXT("ProtoBridge"), FString::Printf(TEXT("Benchmark-%s.json"), *FDateTime::Now().ToString()));
+}
+
+namespace
+{
+	void RunCodecBenchmark(const TArray<FString>& Args)
+	{
+		FProtoBridgeBenchmarkOptions Options;
+		if (Args.Num() > 0)
+		{
+			Options.Iterations = FMath::Max(1, FCString::Atoi(*Args[0]));
+		}
+		const FString Path = Args.Num() > 1 ? Args[1] : FProtoBridgeBenchmarkSuite::GetDefaultOutputPath();
+
+		TArray<FProtoBridgeBenchmarkResult> Results;
+		if (FProtoBridgeBenchmarkSuite::Run(Options, Results))
+		{
+			FProtoBridgeBenchmarkSuite::WriteJson(Options, Results, Path);
+		}
+	}
+
+	FAutoConsoleCommand CodecBenchmarkCommand(
+		TEXT("ProtoBridge.Benchmark.Codec"),
+		TEXT("Measures encode, decode and JSON throughput of the generated codec against tagged properties and FJsonObjectConverter. Usage: ProtoBridge.Benchmark.Codec [Iterations] [Path]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunCodecBenchmark));
+}
\ No newline at end of file
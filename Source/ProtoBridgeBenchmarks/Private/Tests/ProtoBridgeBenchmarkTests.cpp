@@ -0,0 +1,44 @@
+﻿#include "ProtoBridgeBenchmarkSuite.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FProtoBridgeCodecBenchmarkTest, "ProtoBridge.Benchmarks.Codec",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FProtoBridgeCodecBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const FString& Schema : FProtoBridgeBenchmarkSuite::GetSchemaNames())
+	{
+		for (const FString& Codec : FProtoBridgeBenchmarkSuite::GetCodecNames())
+		{
+			OutBeautifiedNames.Add(FString::Printf(TEXT("%s.%s"), *Schema, *Codec));
+			OutTestCommands.Add(FString::Printf(TEXT("%s %s"), *Schema, *Codec));
+		}
+	}
+}
+
+bool FProtoBridgeCodecBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FProtoBridgeBenchmarkOptions Options;
+	Options.Iterations = 200;
+	if (!Parameters.Split(TEXT(" "), &Options.Schema, &Options.Codec))
+	{
+		AddError(FString::Printf(TEXT("Malformed benchmark parameters '%s'"), *Parameters));
+		return false;
+	}
+
+	TArray<FProtoBridgeBenchmarkResult> Results;
+	const bool bSuccess = FProtoBridgeBenchmarkSuite::Run(Options, Results);
+	for (const FProtoBridgeBenchmarkResult& Result : Results)
+	{
+		AddInfo(FString::Printf(TEXT("%s: %lld B, %.1f ns/op, %.1f MB/s, %.1f allocs/op"),
+			*Result.Operation, Result.BytesPerOp, Result.NsPerOp, Result.MegabytesPerSecond, Result.AllocationsPerOp));
+	}
+
+	TestTrue(TEXT("Benchmark succeeded"), bSuccess);
+	TestTrue(TEXT("Benchmark produced results"), Results.Num() > 0);
+	return bSuccess;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+﻿using System.IO;
+using UnrealBuildTool;
+
+public class ProtoBridgeBenchmarks : ModuleRules
+{
+	public ProtoBridgeBenchmarks(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] { 
+			"Core",
+			"CoreUObject"
+		});
+		
+		PrivateDependencyModuleNames.AddRange(new string[] { 
+			"Engine",
+			"GameplayTags",
+			"Json",
+			"JsonUtilities",
+			"Projects",
+			"ProtoBridgeCore",
+			"ProtoBridgeThirdParty"
+		});
+
+		// Proto/CodecBenchmark.proto is compiled into Private/Generated by the plugin's pre-build step (scripts/generate_schemas)
+		// whenever protoc and bridge_generator are available; rules evaluation only checks for its output.
+		string GeneratedDirectory = Path.Combine(ModuleDirectory, "Private", "Generated");
+		bool bHasGeneratedSchemas = File.Exists(Path.Combine(GeneratedDirectory, "CodecBenchmark.ue.h"))
+			&& File.Exists(Path.Combine(GeneratedDirectory, "CodecBenchmarkArena.ue.h"));
+		if (bHasGeneratedSchemas)
+		{
+			PrivateIncludePaths.Add(GeneratedDirectory);
+		}
+		PrivateDefinitions.Add("WITH_PROTOBRIDGE_BENCHMARK_SCHEMAS=" + (bHasGeneratedSchemas ? "1" : "0"));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ProtoBridgeBenchmarkCommandlet.generated.h"
+
+/** Runs the codec benchmark suite headless. Usage: -run=ProtoBridgeBenchmark [-Iterations=N] [-CollectionSize=N] [-Schema=Name] [-Codec=Name] [-Output=Path] */
+UCLASS()
+class UProtoBridgeBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UProtoBridgeBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
\ No newline at end of file
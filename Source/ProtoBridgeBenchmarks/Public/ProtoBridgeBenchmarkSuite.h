@@ -0,0 +1,36 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+struct FProtoBridgeBenchmarkOptions
+{
+	int32 Iterations = 2000;
+	/** Element count for the repeated, string and map schemas. */
+	int32 CollectionSize = 256;
+	/** Runs only the schema or codec with this name when set; see GetSchemaNames and GetCodecNames. */
+	FString Schema;
+	FString Codec;
+};
+
+struct FProtoBridgeBenchmarkResult
+{
+	FString Schema;
+	FString Codec;
+	FString Operation;
+	int64 BytesPerOp = 0;
+	double NsPerOp = 0.0;
+	double MegabytesPerSecond = 0.0;
+	/** Process-wide FMalloc calls per operation, or -1 when the engine is built without STATS. */
+	double AllocationsPerOp = 0.0;
+};
+
+class PROTOBRIDGEBENCHMARKS_API FProtoBridgeBenchmarkSuite
+{
+public:
+	/** Runs each schema through the generated codec with and without arena allocation, tagged-property serialization and FJsonObjectConverter on the calling thread. */
+	static bool Run(const FProtoBridgeBenchmarkOptions& Options, TArray<FProtoBridgeBenchmarkResult>& OutResults);
+	static bool WriteJson(const FProtoBridgeBenchmarkOptions& Options, const TArray<FProtoBridgeBenchmarkResult>& Results, const FString& Path);
+	static FString GetDefaultOutputPath();
+	static TArray<FString> GetSchemaNames();
+	static TArray<FString> GetCodecNames();
+};
\ No newline at end of file
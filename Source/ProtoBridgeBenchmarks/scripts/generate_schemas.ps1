@@ -0,0 +1,68 @@
+# Pre-build step for ProtoBridgeBenchmarks: compiles Proto/CodecBenchmark.proto, and an arena-enabled copy of it,
+# into Private/Generated the same way the editor's generation pipeline does.
+$ErrorActionPreference = "Stop"
+
+$ScriptDir = $PSScriptRoot
+$ModuleDir = Join-Path $ScriptDir ".."
+$PluginDir = Join-Path $ModuleDir "..\.."
+$ProtoDir = Join-Path $ModuleDir "Proto"
+$GeneratedDir = Join-Path $ModuleDir "Private\Generated"
+$CommonProtoDir = Join-Path $PluginDir "Proto"
+$IncludeDir = Join-Path $PluginDir "Source\ProtoBridgeThirdParty\includes"
+$ArenaProtoDir = Join-Path $PluginDir "Intermediate\ProtoBridgeBenchmarks\Proto"
+
+function Find-Binary([string]$Name) {
+    foreach ($Folder in @("Source\ProtoBridgeThirdParty\bin", "Binaries\ThirdParty", "Resources\Binaries")) {
+        foreach ($Candidate in @((Join-Path $PluginDir "$Folder\Win64\$Name.exe"), (Join-Path $PluginDir "$Folder\$Name.exe"))) {
+            if (Test-Path $Candidate) { return (Resolve-Path $Candidate).Path }
+        }
+    }
+    return $null
+}
+
+$Protoc = Find-Binary "protoc"
+$Generator = Find-Binary "bridge_generator"
+if (-not $Protoc -or -not $Generator) {
+    Write-Host "ProtoBridgeBenchmarks: protoc or bridge_generator not found; benchmark schemas are not generated."
+    exit 0
+}
+
+New-Item -ItemType Directory -Path $GeneratedDir -Force | Out-Null
+New-Item -ItemType Directory -Path $ArenaProtoDir -Force | Out-Null
+$ArenaProto = Join-Path $ArenaProtoDir "CodecBenchmarkArena.proto"
+$ArenaSource = (Get-Content -Raw (Join-Path $ProtoDir "CodecBenchmark.proto")) -replace "(?m)^package ProtoBridgeBench;", "package ProtoBridgeBenchArena;"
+if (-not (Test-Path $ArenaProto) -or (Get-Content -Raw $ArenaProto) -ne $ArenaSource) {
+    [System.IO.File]::WriteAllText($ArenaProto, $ArenaSource)
+}
+
+$Inputs = @((Join-Path $ProtoDir "CodecBenchmark.proto"), $ArenaProto, (Join-Path $CommonProtoDir "unreal_common.proto"), $Protoc, $Generator)
+$NewestInput = ($Inputs | ForEach-Object { (Get-Item $_).LastWriteTimeUtc } | Measure-Object -Maximum).Maximum
+$UpToDate = $true
+foreach ($Output in @("CodecBenchmark.ue.h", "CodecBenchmark.ue.cpp", "CodecBenchmarkArena.ue.h", "CodecBenchmarkArena.ue.cpp", "unreal_common.ue.h")) {
+    $OutputPath = Join-Path $GeneratedDir $Output
+    if (-not (Test-Path $OutputPath) -or (Get-Item $OutputPath).LastWriteTimeUtc -lt $NewestInput) { $UpToDate = $false }
+}
+if ($UpToDate) { exit 0 }
+
+$ProtocArgs = @(
+    "--plugin=protoc-gen-ue=$Generator",
+    "--ue_out=$GeneratedDir",
+    "--cpp_out=$GeneratedDir",
+    "--proto_path=$ProtoDir",
+    "--proto_path=$ArenaProtoDir",
+    "--proto_path=$IncludeDir",
+    "--proto_path=$CommonProtoDir"
+)
+& $Protoc @ProtocArgs "--ue_opt=PROTOBRIDGEBENCHMARKS_API" "CodecBenchmark.proto" "unreal_common.proto"
+if ($LASTEXITCODE -ne 0) { exit $LASTEXITCODE }
+& $Protoc @ProtocArgs "--ue_opt=PROTOBRIDGEBENCHMARKS_API,arena" "CodecBenchmarkArena.proto"
+if ($LASTEXITCODE -ne 0) { exit $LASTEXITCODE }
+
+# Same check/verify guard FGeneratedCodePostProcessor wraps around editor-generated protobuf sources.
+$GuardStart = "// UE_PROTOBRIDGE_MACRO_GUARD_START`n#ifdef check`n  #pragma push_macro(`"check`")`n  #undef check`n#endif`n#ifdef verify`n  #pragma push_macro(`"verify`")`n  #undef verify`n#endif`n`n"
+$GuardEnd = "`n// UE_PROTOBRIDGE_MACRO_GUARD_END`n#ifdef check`n  #pragma pop_macro(`"check`")`n#endif`n#ifdef verify`n  #pragma pop_macro(`"verify`")`n#endif`n"
+foreach ($File in Get-ChildItem -Path $GeneratedDir -File | Where-Object { $_.Name -like "*.pb.h" -or $_.Name -like "*.pb.cc" }) {
+    $Content = [System.IO.File]::ReadAllText($File.FullName)
+    if ($Content.Length -eq 0 -or $Content.Contains("UE_PROTOBRIDGE_MACRO_GUARD")) { continue }
+    [System.IO.File]::WriteAllText($File.FullName, $GuardStart + $Content + $GuardEnd)
+}
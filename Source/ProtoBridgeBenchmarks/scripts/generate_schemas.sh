@@ -0,0 +1,87 @@
+#!/bin/bash
+# Pre-build step for ProtoBridgeBenchmarks: compiles Proto/CodecBenchmark.proto, and an arena-enabled copy of it,
+# into Private/Generated the same way the editor's generation pipeline does.
+set -e
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" &> /dev/null && pwd )"
+MODULE_DIR="$SCRIPT_DIR/.."
+PLUGIN_DIR="$MODULE_DIR/../.."
+PROTO_DIR="$MODULE_DIR/Proto"
+GENERATED_DIR="$MODULE_DIR/Private/Generated"
+COMMON_PROTO_DIR="$PLUGIN_DIR/Proto"
+INCLUDE_DIR="$PLUGIN_DIR/Source/ProtoBridgeThirdParty/includes"
+ARENA_PROTO_DIR="$PLUGIN_DIR/Intermediate/ProtoBridgeBenchmarks/Proto"
+
+if [[ "$(uname)" == "Darwin" ]]; then
+    PLATFORM="Mac"
+else
+    PLATFORM="Linux"
+fi
+
+find_binary() {
+    for FOLDER in "Source/ProtoBridgeThirdParty/bin" "Binaries/ThirdParty" "Resources/Binaries"; do
+        for CANDIDATE in "$PLUGIN_DIR/$FOLDER/$PLATFORM/$1" "$PLUGIN_DIR/$FOLDER/$1"; do
+            if [ -x "$CANDIDATE" ]; then
+                echo "$CANDIDATE"
+                return
+            fi
+        done
+    done
+}
+
+PROTOC="$(find_binary protoc)"
+GENERATOR="$(find_binary bridge_generator)"
+if [ -z "$PROTOC" ] || [ -z "$GENERATOR" ]; then
+    echo "ProtoBridgeBenchmarks: protoc or bridge_generator not found; benchmark schemas are not generated."
+    exit 0
+fi
+
+mkdir -p "$GENERATED_DIR" "$ARENA_PROTO_DIR"
+ARENA_PROTO="$ARENA_PROTO_DIR/CodecBenchmarkArena.proto"
+sed 's/^package ProtoBridgeBench;/package ProtoBridgeBenchArena;/' "$PROTO_DIR/CodecBenchmark.proto" > "$ARENA_PROTO.tmp"
+if cmp -s "$ARENA_PROTO.tmp" "$ARENA_PROTO"; then
+    rm "$ARENA_PROTO.tmp"
+else
+    mv "$ARENA_PROTO.tmp" "$ARENA_PROTO"
+fi
+
+UP_TO_DATE=true
+for OUTPUT in CodecBenchmark.ue.h CodecBenchmark.ue.cpp CodecBenchmarkArena.ue.h CodecBenchmarkArena.ue.cpp unreal_common.ue.h; do
+    for INPUT in "$PROTO_DIR/CodecBenchmark.proto" "$ARENA_PROTO" "$COMMON_PROTO_DIR/unreal_common.proto" "$PROTOC" "$GENERATOR"; do
+        if [ ! -f "$GENERATED_DIR/$OUTPUT" ] || [ "$INPUT" -nt "$GENERATED_DIR/$OUTPUT" ]; then
+            UP_TO_DATE=false
+        fi
+    done
+done
+if [ "$UP_TO_DATE" = true ]; then
+    exit 0
+fi
+
+PROTOC_ARGS=(
+    "--plugin=protoc-gen-ue=$GENERATOR"
+    "--ue_out=$GENERATED_DIR"
+    "--cpp_out=$GENERATED_DIR"
+    "--proto_path=$PROTO_DIR"
+    "--proto_path=$ARENA_PROTO_DIR"
+    "--proto_path=$INCLUDE_DIR"
+    "--proto_path=$COMMON_PROTO_DIR"
+)
+"$PROTOC" "${PROTOC_ARGS[@]}" "--ue_opt=PROTOBRIDGEBENCHMARKS_API" CodecBenchmark.proto unreal_common.proto
+"$PROTOC" "${PROTOC_ARGS[@]}" "--ue_opt=PROTOBRIDGEBENCHMARKS_API,arena" CodecBenchmarkArena.proto
+
+# Same check/verify guard FGeneratedCodePostProcessor wraps around editor-generated protobuf sources.
+for FILE in "$GENERATED_DIR"/*.pb.h "$GENERATED_DIR"/*.pb.cc; do
+    if [ ! -s "$FILE" ] || grep -q "UE_PROTOBRIDGE_MACRO_GUARD" "$FILE"; then
+        continue
+    fi
+    {
+        printf '// UE_PROTOBRIDGE_MACRO_GUARD_START\n'
+        printf '#ifdef check\n  #pragma push_macro("check")\n  #undef check\n#endif\n'
+        printf '#ifdef verify\n  #pragma push_macro("verify")\n  #undef verify\n#endif\n\n'
+        cat "$FILE"
+        printf '\n// UE_PROTOBRIDGE_MACRO_GUARD_END\n'
+        printf '#ifdef check\n  #pragma pop_macro("check")\n#endif\n'
+        printf '#ifdef verify\n  #pragma pop_macro("verify")\n#endif\n'
+    } > "$FILE.tmp"
+    mv "$FILE.tmp" "$FILE"
+done
@@ -0,0 +1,95 @@
+﻿#include "ProtoBridgeArenaPool.h"
+#include "ProtobufIncludes.h"
+#include "ProtoBridgeMemory.h"
+
+namespace
+{
+	void* AllocateArenaBlock(size_t Size)
+	{
+		LLM_SCOPE_BYTAG(ProtoBridge_Arena);
+		return FMemory::Malloc(Size, 16);
+	}
+
+	void FreeArenaBlock(void* Block, size_t Size)
+	{
+		FMemory::Free(Block);
+	}
+
+	struct FThreadArena
+	{
+		void* InitialBlock;
+		TUniquePtr<google::protobuf::Arena> Arena;
+		int32 Depth;
+		FProtoArenaStats Stats;
+
+		FThreadArena()
+			: InitialBlock(AllocateArenaBlock(FProtoBridgeArenaPool::InitialBlockSize))
+			, Depth(0)
+		{
+			google::protobuf::ArenaOptions Options;
+			Options.initial_block = static_cast<char*>(InitialBlock);
+			Options.initial_block_size = FProtoBridgeArenaPool::InitialBlockSize;
+			Options.start_block_size = FProtoBridgeArenaPool::InitialBlockSize;
+			Options.max_block_size = FProtoBridgeArenaPool::MaxBlockSize;
+			Options.block_alloc = &AllocateArenaBlock;
+			Options.block_dealloc = &FreeArenaBlock;
+			Arena = MakeUnique<google::protobuf::Arena>(Options);
+		}
+
+		~FThreadArena()
+		{
+			Arena.Reset();
+			FMemory::Free(InitialBlock);
+		}
+	};
+
+	FThreadArena& GetThreadArena()
+	{
+		static thread_local FThreadArena ThreadArena;
+		return ThreadArena;
+	}
+}
+
+google::protobuf::Arena* FProtoBridgeArenaPool::AcquireThreadArena()
+{
+	FThreadArena& State = GetThreadArena();
+	++State.Depth;
+	++State.Stats.Acquisitions;
+	return State.Arena.Get();
+}
+
+void FProtoBridgeArenaPool::ReleaseThreadArena()
+{
+	FThreadArena& State = GetThreadArena();
+	check(State.Depth > 0);
+
+	if (--State.Depth > 0)
+	{
+		return;
+	}
+
+	const uint64 SpaceAllocated = State.Arena->SpaceAllocated();
+	State.Stats.PeakSpaceAllocated = FMath::Max(State.Stats.PeakSpaceAllocated, SpaceAllocated);
+	if (SpaceAllocated > static_cast<uint64>(InitialBlockSize))
+	{
+		++State.Stats.OverflowResets;
+	}
+
+	State.Arena->Reset();
+	++State.Stats.Resets;
+}
+
+FProtoArenaStats FProtoBridgeArenaPool::GetThreadStats()
+{
+	return GetThreadArena().Stats;
+}
+
+FProtoArenaScope::FProtoArenaScope()
+	: Arena(FProtoBridgeArenaPool::AcquireThreadArena())
+{
+}
+
+FProtoArenaScope::~FProtoArenaScope()
+{
+	FProtoBridgeArenaPool::ReleaseThreadArena();
+}
\ No newline at end of file
@@ -1,11 +1,16 @@
 #include "ProtoBridgeCoreModule.h"
+#include "GameplayTagsModule.h"
+#include "ProtoBridgeNameCache.h"
 
 void FProtoBridgeCoreModule::StartupModule()
 {
+	TagTreeChangedHandle = IGameplayTagsModule::OnGameplayTagTreeChanged.AddStatic(&FProtoBridgeNameCache::InvalidateGameplayTags);
 }
 
 void FProtoBridgeCoreModule::ShutdownModule()
 {
+	IGameplayTagsModule::OnGameplayTagTreeChanged.Remove(TagTreeChangedHandle);
+	FProtoBridgeNameCache::Reset();
 }
 
 IMPLEMENT_MODULE(FProtoBridgeCoreModule, ProtoBridgeCore)
\ No newline at end of file
@@ -7,6 +7,7 @@ UProtoBridgeCoreSettings::UProtoBridgeCoreSettings()
 	MaxAnyPayloadSize = 32 * 1024 * 1024;
 	MaxByteArraySize = 64 * 1024 * 1024;
 	MaxJsonRecursionDepth = 75;
+	QuantizedVectorScale = 10;
 }
 
 void UProtoBridgeCoreSettings::PostInitProperties()
@@ -17,6 +18,7 @@ void UProtoBridgeCoreSettings::PostInitProperties()
 	if (MaxByteArraySize < 1024) MaxByteArraySize = 1024;
 	if (MaxJsonRecursionDepth < 1) MaxJsonRecursionDepth = 1;
 	if (MaxJsonRecursionDepth > 1000) MaxJsonRecursionDepth = 1000;
+	QuantizedVectorScale = FMath::Clamp(QuantizedVectorScale, 1, 10000);
 }
 
 FName UProtoBridgeCoreSettings::GetContainerName() const
@@ -7,13 +7,13 @@ namespace ProtoBridge::EncoderRegistry
 {
 	namespace
 	{
-		bool EncodeIntegerVariant(const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext& Context)
+		bool EncodeIntegerVariant(const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext& Context, void*)
 		{
 			const int64 Val = V.GetValue<int64>();
 			return FProtobufReflectionUtils::ConvertInt64ToProtoValue(Val, Out, Context);
 		}
 
-		void RegisterNumericEncoders(TMap<EVariantTypes, FVariantEncoder>& OutEncoders)
+		void RegisterNumericEncoders(FVariantEncoderTable& OutEncoders)
 		{
 			const EVariantTypes IntTypes[] = {
 				EVariantTypes::Int8, EVariantTypes::Int16, EVariantTypes::Int32, EVariantTypes::Int64,
@@ -22,46 +22,46 @@ namespace ProtoBridge::EncoderRegistry
 
 			for (const EVariantTypes Type : IntTypes)
 			{
-				OutEncoders.Add(Type, &EncodeIntegerVariant);
+				OutEncoders.Set(Type, &EncodeIntegerVariant);
 			}
 
-			auto FloatEncoder = [](const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext&) -> bool {
+			auto FloatEncoder = [](const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext&, void*) -> bool {
 				Out.set_number_value(V.GetValue<double>());
 				return true;
 			};
-			OutEncoders.Add(EVariantTypes::Float, FloatEncoder);
-			OutEncoders.Add(EVariantTypes::Double, FloatEncoder);
+			OutEncoders.Set(EVariantTypes::Float, FloatEncoder);
+			OutEncoders.Set(EVariantTypes::Double, FloatEncoder);
 		}
 
-		void RegisterPrimitiveEncoders(TMap<EVariantTypes, FVariantEncoder>& OutEncoders)
+		void RegisterPrimitiveEncoders(FVariantEncoderTable& OutEncoders)
 		{
-			auto NullEncoder = [](const FVariant&, google::protobuf::Value& Out, const FProtoSerializationContext&) -> bool { 
+			auto NullEncoder = [](const FVariant&, google::protobuf::Value& Out, const FProtoSerializationContext&, void*) -> bool { 
 				Out.set_null_value(google::protobuf::NULL_VALUE); 
 				return true;
 			};
-			OutEncoders.Add(EVariantTypes::Empty, NullEncoder);
+			OutEncoders.Set(EVariantTypes::Empty, NullEncoder);
 
-			OutEncoders.Add(EVariantTypes::Bool, [](const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext&) -> bool {
+			OutEncoders.Set(EVariantTypes::Bool, [](const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext&, void*) -> bool {
 				Out.set_bool_value(V.GetValue<bool>());
 				return true;
 			});
 		}
 		
-		void RegisterStringEncoders(TMap<EVariantTypes, FVariantEncoder>& OutEncoders)
+		void RegisterStringEncoders(FVariantEncoderTable& OutEncoders)
 		{
-			OutEncoders.Add(EVariantTypes::String, [](const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext&) -> bool {
+			OutEncoders.Set(EVariantTypes::String, [](const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext&, void*) -> bool {
 				FProtobufStringUtils::FStringToStdString(V.GetValue<FString>(), *Out.mutable_string_value());
 				return true;
 			});
 
-			OutEncoders.Add(EVariantTypes::Name, [](const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext&) -> bool {
+			OutEncoders.Set(EVariantTypes::Name, [](const FVariant& V, google::protobuf::Value& Out, const FProtoSerializationContext&, void*) -> bool {
 				FProtobufStringUtils::FNameToStdString(V.GetValue<FName>(), *Out.mutable_string_value());
 				return true;
 			});
 		}
 	}
 
-	void GetDefaultEncoders(TMap<EVariantTypes, FVariantEncoder>& OutEncoders)
+	void GetDefaultEncoders(FVariantEncoderTable& OutEncoders)
 	{
 		RegisterPrimitiveEncoders(OutEncoders);
 		RegisterNumericEncoders(OutEncoders);
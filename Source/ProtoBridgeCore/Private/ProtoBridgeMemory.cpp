@@ -0,0 +1,46 @@
+﻿#include "ProtoBridgeMemory.h"
+#include "HAL/IConsoleManager.h"
+#include "ProtoBridgeLogs.h"
+
+LLM_DEFINE_TAG(ProtoBridge);
+LLM_DEFINE_TAG(ProtoBridge_Decode);
+LLM_DEFINE_TAG(ProtoBridge_Encode);
+LLM_DEFINE_TAG(ProtoBridge_Json);
+LLM_DEFINE_TAG(ProtoBridge_Arena);
+
+void FProtoBridgeMemory::ReportTags()
+{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	FLowLevelMemTracker& Tracker = FLowLevelMemTracker::Get();
+	if (!FLowLevelMemTracker::IsEnabled())
+	{
+		UE_LOG(LogProtoBridgeCore, Display, TEXT("LLM is not running; launch with -llm to attribute ProtoBridge allocations."));
+		return;
+	}
+
+	const FName TagNames[] =
+	{
+		LLM_TAG_NAME(ProtoBridge),
+		LLM_TAG_NAME(ProtoBridge_Decode),
+		LLM_TAG_NAME(ProtoBridge_Encode),
+		LLM_TAG_NAME(ProtoBridge_Json),
+		LLM_TAG_NAME(ProtoBridge_Arena)
+	};
+
+	for (const FName& TagName : TagNames)
+	{
+		const int64 LiveBytes = Tracker.GetTagAmountForTracker(ELLMTracker::Default, TagName, ELLMTagSet::None);
+		UE_LOG(LogProtoBridgeCore, Display, TEXT("%-24s %10.3f MB (%lld bytes)"), *TagName.ToString(), LiveBytes / (1024.0 * 1024.0), LiveBytes);
+	}
+#else
+	UE_LOG(LogProtoBridgeCore, Display, TEXT("This build was compiled without the Low Level Memory Tracker."));
+#endif
+}
+
+namespace
+{
+	FAutoConsoleCommand ReportMemoryCommand(
+		TEXT("ProtoBridge.Memory.Report"),
+		TEXT("Logs live bytes for each ProtoBridge LLM tag. Requires running with -llm."),
+		FConsoleCommandDelegate::CreateStatic(&FProtoBridgeMemory::ReportTags));
+}
\ No newline at end of file
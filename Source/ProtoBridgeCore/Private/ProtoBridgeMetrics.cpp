@@ -0,0 +1,259 @@
+﻿#include "ProtoBridgeMetrics.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProtoBridgeLogs.h"
+
+UE_TRACE_CHANNEL_DEFINE(ProtoBridgeChannel);
+
+DECLARE_CYCLE_STAT(TEXT("ToProto"), STAT_ProtoBridge_ToProto, STATGROUP_ProtoBridge);
+DECLARE_CYCLE_STAT(TEXT("FromProto"), STAT_ProtoBridge_FromProto, STATGROUP_ProtoBridge);
+DECLARE_CYCLE_STAT(TEXT("Encode"), STAT_ProtoBridge_Encode, STATGROUP_ProtoBridge);
+DECLARE_CYCLE_STAT(TEXT("Decode"), STAT_ProtoBridge_Decode, STATGROUP_ProtoBridge);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bytes Encoded"), STAT_ProtoBridge_BytesEncoded, STATGROUP_ProtoBridge);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bytes Decoded"), STAT_ProtoBridge_BytesDecoded, STATGROUP_ProtoBridge);
+
+namespace
+{
+	bool GProtoBridgeMetricsEnabled = true;
+	FAutoConsoleVariableRef CVarProtoBridgeMetricsEnabled(
+		TEXT("ProtoBridge.Metrics.Enabled"),
+		GProtoBridgeMetricsEnabled,
+		TEXT("Records per-type counters in code generated with the 'metrics' option."));
+
+	struct FSiteRegistry
+	{
+		FCriticalSection Lock;
+		TArray<FProtoMetricSite*> Sites;
+	};
+
+	FSiteRegistry& GetRegistry()
+	{
+		static FSiteRegistry Registry;
+		return Registry;
+	}
+
+	TStatId GetOpStatId(EProtoMetricOp Op)
+	{
+		switch (Op)
+		{
+		case EProtoMetricOp::ToProto: return GET_STATID(STAT_ProtoBridge_ToProto);
+		case EProtoMetricOp::FromProto: return GET_STATID(STAT_ProtoBridge_FromProto);
+		case EProtoMetricOp::Encode: return GET_STATID(STAT_ProtoBridge_Encode);
+		default: return GET_STATID(STAT_ProtoBridge_Decode);
+		}
+	}
+
+	int32 GetHistogramBucket(uint64 InCycles)
+	{
+		const uint64 Micros = static_cast<uint64>(FPlatformTime::ToSeconds64(InCycles) * 1.0e6);
+		if (Micros == 0)
+		{
+			return 0;
+		}
+		return FMath::Min(static_cast<int32>(FMath::FloorLog2_64(Micros)) + 1, FProtoMetricSite::NumHistogramBuckets - 1);
+	}
+}
+
+FProtoMetricSite::FProtoMetricSite(const TCHAR* InTypeName, EProtoMetricOp InOp)
+	: TypeName(InTypeName)
+	, Op(InOp)
+{
+	FSiteRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	Registry.Sites.Add(this);
+}
+
+FProtoMetricSite::~FProtoMetricSite()
+{
+	FSiteRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	Registry.Sites.RemoveSingleSwap(this);
+}
+
+void FProtoMetricSite::Record(uint64 InCycles, int64 InBytes)
+{
+	Calls.fetch_add(1, std::memory_order_relaxed);
+	Cycles.fetch_add(InCycles, std::memory_order_relaxed);
+	Histogram[GetHistogramBucket(InCycles)].fetch_add(1, std::memory_order_relaxed);
+
+	if (InBytes > 0)
+	{
+		Bytes.fetch_add(static_cast<uint64>(InBytes), std::memory_order_relaxed);
+		if (Op == EProtoMetricOp::Encode)
+		{
+			INC_DWORD_STAT_BY(STAT_ProtoBridge_BytesEncoded, InBytes);
+		}
+		else if (Op == EProtoMetricOp::Decode)
+		{
+			INC_DWORD_STAT_BY(STAT_ProtoBridge_BytesDecoded, InBytes);
+		}
+	}
+}
+
+void FProtoMetricSite::Reset()
+{
+	Calls.store(0, std::memory_order_relaxed);
+	Bytes.store(0, std::memory_order_relaxed);
+	Cycles.store(0, std::memory_order_relaxed);
+	for (std::atomic<uint64>& Bucket : Histogram)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+}
+
+uint32 FProtoMetricSite::GetTraceSpecId()
+{
+	uint32 SpecId = TraceSpecId.load(std::memory_order_relaxed);
+	if (SpecId == 0)
+	{
+		const FString EventName = FString::Printf(TEXT("%s::%s"), TypeName, FProtoBridgeMetrics::GetOpName(Op));
+		SpecId = FCpuProfilerTrace::OutputEventType(*EventName);
+		TraceSpecId.store(SpecId, std::memory_order_relaxed);
+	}
+	return SpecId;
+}
+
+FProtoMetricScope::FProtoMetricScope(FProtoMetricSite& InSite, int64 InBytes)
+	: StatScope(GetOpStatId(InSite.GetOp()))
+	, Site(GProtoBridgeMetricsEnabled ? &InSite : nullptr)
+	, Output(nullptr)
+	, Bytes(InBytes)
+	, StartCycles(0)
+	, bTraced(false)
+{
+	if (!Site)
+	{
+		return;
+	}
+
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(ProtoBridgeChannel | CpuChannel))
+	{
+		FCpuProfilerTrace::OutputBeginEvent(Site->GetTraceSpecId());
+		bTraced = true;
+	}
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+FProtoMetricScope::FProtoMetricScope(FProtoMetricSite& InSite, const TArray<uint8>& InOutput, bool bAppends)
+	: FProtoMetricScope(InSite, bAppends ? -static_cast<int64>(InOutput.Num()) : 0)
+{
+	Output = &InOutput;
+}
+
+FProtoMetricScope::~FProtoMetricScope()
+{
+	if (!Site)
+	{
+		return;
+	}
+
+	const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+	if (bTraced)
+	{
+		FCpuProfilerTrace::OutputEndEvent();
+	}
+
+	Site->Record(ElapsedCycles, Output ? Output->Num() + Bytes : Bytes);
+}
+
+bool FProtoBridgeMetrics::IsEnabled()
+{
+	return GProtoBridgeMetricsEnabled;
+}
+
+void FProtoBridgeMetrics::ForEachSite(TFunctionRef<void(const FProtoMetricSite&)> Visitor)
+{
+	FSiteRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	for (const FProtoMetricSite* Site : Registry.Sites)
+	{
+		Visitor(*Site);
+	}
+}
+
+void FProtoBridgeMetrics::ResetAll()
+{
+	FSiteRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	for (FProtoMetricSite* Site : Registry.Sites)
+	{
+		Site->Reset();
+	}
+}
+
+bool FProtoBridgeMetrics::DumpCsv(const FString& Path)
+{
+	FString Csv = TEXT("Type,Op,Calls,Bytes,TotalMs,AvgUs");
+	for (int32 Bucket = 0; Bucket < FProtoMetricSite::NumHistogramBuckets; ++Bucket)
+	{
+		Csv += Bucket + 1 < FProtoMetricSite::NumHistogramBuckets
+			? FString::Printf(TEXT(",Under%lluUs"), 1ULL << Bucket)
+			: FString::Printf(TEXT(",Over%lluUs"), 1ULL << (Bucket - 1));
+	}
+	Csv += LINE_TERMINATOR;
+
+	ForEachSite([&Csv](const FProtoMetricSite& Site)
+	{
+		const uint64 Calls = Site.Calls.load(std::memory_order_relaxed);
+		if (Calls == 0)
+		{
+			return;
+		}
+
+		const double TotalMs = FPlatformTime::ToMilliseconds64(Site.Cycles.load(std::memory_order_relaxed));
+		Csv += FString::Printf(TEXT("%s,%s,%llu,%llu,%.3f,%.3f"), Site.GetTypeName(), GetOpName(Site.GetOp()),
+			Calls, Site.Bytes.load(std::memory_order_relaxed), TotalMs, TotalMs * 1000.0 / Calls);
+		for (const std::atomic<uint64>& Bucket : Site.Histogram)
+		{
+			Csv += FString::Printf(TEXT(",%llu"), Bucket.load(std::memory_order_relaxed));
+		}
+		Csv += LINE_TERMINATOR;
+	});
+
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+const TCHAR* FProtoBridgeMetrics::GetOpName(EProtoMetricOp Op)
+{
+	switch (Op)
+	{
+	case EProtoMetricOp::ToProto: return TEXT("ToProto");
+	case EProtoMetricOp::FromProto: return TEXT("FromProto");
+	case EProtoMetricOp::Encode: return TEXT("Encode");
+	case EProtoMetricOp::Decode: return TEXT("Decode");
+	default: return TEXT("Unknown");
+	}
+}
+
+namespace
+{
+	void RunDumpMetricsCsv(const TArray<FString>& Args)
+	{
+		const FString Path = Args.Num() > 0
+			? Args[0]
+			: FPaths::Combine(FPaths::ProfilingDir(), TEXT("ProtoBridge"), FString::Printf(TEXT("Metrics-%s.csv"), *FDateTime::Now().ToString()));
+
+		if (FProtoBridgeMetrics::DumpCsv(Path))
+		{
+			UE_LOG(LogProtoBridgeCore, Display, TEXT("ProtoBridge metrics written to %s"), *Path);
+		}
+		else
+		{
+			UE_LOG(LogProtoBridgeCore, Error, TEXT("Failed to write ProtoBridge metrics to %s"), *Path);
+		}
+	}
+
+	FAutoConsoleCommand DumpMetricsCsvCommand(
+		TEXT("ProtoBridge.Metrics.DumpCsv"),
+		TEXT("Writes per-type call counts, bytes and timing histograms to CSV. Usage: ProtoBridge.Metrics.DumpCsv [Path]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunDumpMetricsCsv));
+
+	FAutoConsoleCommand ResetMetricsCommand(
+		TEXT("ProtoBridge.Metrics.Reset"),
+		TEXT("Clears all ProtoBridge per-type counters."),
+		FConsoleCommandDelegate::CreateStatic(&FProtoBridgeMetrics::ResetAll));
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+﻿#include "ProtoBridgeNameCache.h"
+#include "ProtobufStringUtils.h"
+#include "Hash/CityHash.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProtoBridgeLogs.h"
+#include <atomic>
+#include <string>
+
+namespace
+{
+	struct FNameEntry
+	{
+		std::string Utf8;
+		FName Name;
+	};
+
+	struct FTagEntry
+	{
+		std::string Utf8;
+		FGameplayTag Tag;
+		uint32 Generation;
+	};
+
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FCacheShard
+	{
+		FRWLock Lock;
+		TMap<uint64, FNameEntry> Names;
+		TMap<uint64, FTagEntry> Tags;
+
+		std::atomic<uint64> NameHits{ 0 };
+		std::atomic<uint64> NameMisses{ 0 };
+		std::atomic<uint64> TagHits{ 0 };
+		std::atomic<uint64> TagMisses{ 0 };
+	};
+
+	FCacheShard Shards[FProtoBridgeNameCache::NumShards];
+	std::atomic<uint32> TagGeneration{ 0 };
+
+	FORCEINLINE uint64 HashKey(const ANSICHAR* InData, int32 InLen)
+	{
+		return CityHash64(InData, static_cast<uint32>(InLen));
+	}
+
+	FORCEINLINE FCacheShard& GetShard(uint64 Hash)
+	{
+		return Shards[Hash >> 60];
+	}
+
+	FORCEINLINE bool KeyEquals(const std::string& Stored, const ANSICHAR* InData, int32 InLen)
+	{
+		return Stored.size() == static_cast<size_t>(InLen) && FMemory::Memcmp(Stored.data(), InData, InLen) == 0;
+	}
+}
+
+static_assert(FProtoBridgeNameCache::NumShards == 16, "GetShard uses the top four hash bits.");
+
+FName FProtoBridgeNameCache::ResolveName(const ANSICHAR* InData, int32 InLen)
+{
+	if (InLen <= 0 || InLen > NAME_SIZE) return FProtobufStringUtils::Utf8ToFName(InData, InLen);
+
+	const uint64 Hash = HashKey(InData, InLen);
+	FCacheShard& Shard = GetShard(Hash);
+	{
+		FReadScopeLock ReadLock(Shard.Lock);
+		const FNameEntry* Entry = Shard.Names.Find(Hash);
+		if (Entry && KeyEquals(Entry->Utf8, InData, InLen))
+		{
+			Shard.NameHits.fetch_add(1, std::memory_order_relaxed);
+			return Entry->Name;
+		}
+	}
+
+	Shard.NameMisses.fetch_add(1, std::memory_order_relaxed);
+	const FName Name = FProtobufStringUtils::Utf8ToFName(InData, InLen);
+
+	FWriteScopeLock WriteLock(Shard.Lock);
+	if (Shard.Names.Num() < MaxEntriesPerShard && !Shard.Names.Contains(Hash))
+	{
+		Shard.Names.Add(Hash, FNameEntry{ std::string(InData, InLen), Name });
+	}
+	return Name;
+}
+
+FGameplayTag FProtoBridgeNameCache::ResolveGameplayTag(const ANSICHAR* InData, int32 InLen)
+{
+	if (InLen <= 0) return FGameplayTag();
+
+	const uint64 Hash = HashKey(InData, InLen);
+	FCacheShard& Shard = GetShard(Hash);
+	const uint32 Generation = TagGeneration.load(std::memory_order_acquire);
+	{
+		FReadScopeLock ReadLock(Shard.Lock);
+		const FTagEntry* Entry = Shard.Tags.Find(Hash);
+		if (Entry && Entry->Generation == Generation && KeyEquals(Entry->Utf8, InData, InLen))
+		{
+			Shard.TagHits.fetch_add(1, std::memory_order_relaxed);
+			return Entry->Tag;
+		}
+	}
+
+	Shard.TagMisses.fetch_add(1, std::memory_order_relaxed);
+	const FName TagName = ResolveName(InData, InLen);
+	if (TagName.IsNone()) return FGameplayTag();
+
+	const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+	if (!Tag.IsValid()) return Tag;
+
+	FWriteScopeLock WriteLock(Shard.Lock);
+	if (Generation == TagGeneration.load(std::memory_order_acquire))
+	{
+		FTagEntry* Existing = Shard.Tags.Find(Hash);
+		if (Existing && Existing->Generation != Generation)
+		{
+			*Existing = FTagEntry{ std::string(InData, InLen), Tag, Generation };
+		}
+		else if (!Existing && Shard.Tags.Num() < MaxEntriesPerShard)
+		{
+			Shard.Tags.Add(Hash, FTagEntry{ std::string(InData, InLen), Tag, Generation });
+		}
+	}
+	return Tag;
+}
+
+void FProtoBridgeNameCache::InvalidateGameplayTags()
+{
+	TagGeneration.fetch_add(1, std::memory_order_acq_rel);
+	for (FCacheShard& Shard : Shards)
+	{
+		FWriteScopeLock WriteLock(Shard.Lock);
+		Shard.Tags.Empty();
+	}
+}
+
+void FProtoBridgeNameCache::Reset()
+{
+	TagGeneration.fetch_add(1, std::memory_order_acq_rel);
+	for (FCacheShard& Shard : Shards)
+	{
+		FWriteScopeLock WriteLock(Shard.Lock);
+		Shard.Names.Empty();
+		Shard.Tags.Empty();
+	}
+}
+
+FProtoNameCacheStats FProtoBridgeNameCache::GetStats()
+{
+	FProtoNameCacheStats Stats;
+	for (const FCacheShard& Shard : Shards)
+	{
+		Stats.NameHits += Shard.NameHits.load(std::memory_order_relaxed);
+		Stats.NameMisses += Shard.NameMisses.load(std::memory_order_relaxed);
+		Stats.TagHits += Shard.TagHits.load(std::memory_order_relaxed);
+		Stats.TagMisses += Shard.TagMisses.load(std::memory_order_relaxed);
+	}
+	return Stats;
+}
+
+void FProtoBridgeNameCache::ResetStats()
+{
+	for (FCacheShard& Shard : Shards)
+	{
+		Shard.NameHits.store(0, std::memory_order_relaxed);
+		Shard.NameMisses.store(0, std::memory_order_relaxed);
+		Shard.TagHits.store(0, std::memory_order_relaxed);
+		Shard.TagMisses.store(0, std::memory_order_relaxed);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	FAutoConsoleCommand NameCacheStatsCommand(
+		TEXT("ProtoBridge.NameCache.Stats"),
+		TEXT("Logs FName / GameplayTag cache hit and miss counters."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			const FProtoNameCacheStats Stats = FProtoBridgeNameCache::GetStats();
+			UE_LOG(LogProtoBridgeCore, Display, TEXT("NameCache: names %llu hits / %llu misses, tags %llu hits / %llu misses"),
+				Stats.NameHits, Stats.NameMisses, Stats.TagHits, Stats.TagMisses);
+		}));
+}
+
+#endif
\ No newline at end of file
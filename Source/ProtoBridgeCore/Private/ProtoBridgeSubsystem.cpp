@@ -4,6 +4,13 @@
 #include "ProtobufIncludes.h"
 #include "ProtoBridgeCoreSettings.h"
 #include "ProtoBridgeLogs.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	/** Process-wide so a subsystem recreated at the same address never repeats a version a thread has cached. */
+	std::atomic<uint32> GNextContextVersion { 0 };
+}
 
 void UProtoBridgeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -11,17 +18,19 @@ void UProtoBridgeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	
 	bIsInitialized = false;
 
-	const UProtoBridgeCoreSettings* Settings = GetDefault<UProtoBridgeCoreSettings>();
-	Int64Strategy = Settings->Int64SerializationStrategy;
-	
 	{
-		FWriteScopeLock Lock(StateLock);
-		VariantEncoders = MakeShared<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe>();
+		FScopeLock Lock(&PublishLock);
+		Int64Strategy = GetDefault<UProtoBridgeCoreSettings>()->Int64SerializationStrategy;
 	}
+	
+	PublishEncoders([](FVariantEncoderTable& Table)
+	{
+		ProtoBridge::EncoderRegistry::GetDefaultEncoders(Table);
+	});
 
-	TMap<EVariantTypes, FVariantEncoder> DefaultEncoders;
-	ProtoBridge::EncoderRegistry::GetDefaultEncoders(DefaultEncoders);
-	RegisterEncodersBatch(DefaultEncoders);
+#if WITH_EDITOR
+	SettingsChangedHandle = GetMutableDefault<UProtoBridgeCoreSettings>()->OnSettingChanged().AddUObject(this, &UProtoBridgeSubsystem::HandleSettingsChanged);
+#endif
 
 	bIsInitialized = true;
 }
@@ -29,83 +38,138 @@ void UProtoBridgeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void UProtoBridgeSubsystem::Deinitialize()
 {
 	bIsInitialized = false;
+
+#if WITH_EDITOR
+	GetMutableDefault<UProtoBridgeCoreSettings>()->OnSettingChanged().Remove(SettingsChangedHandle);
+	SettingsChangedHandle.Reset();
+#endif
+
 	{
-		FWriteScopeLock Lock(StateLock);
-		VariantEncoders = MakeShared<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe>();
+		FScopeLock Lock(&PublishLock);
+		ActiveEncoders = nullptr;
+		RebuildContextLocked();
 	}
 	Super::Deinitialize();
 }
 
-void UProtoBridgeSubsystem::RegisterVariantEncoder(EVariantTypes Type, FVariantEncoder Encoder)
+void UProtoBridgeSubsystem::RegisterVariantEncoder(EVariantTypes Type, FVariantEncoderFunc Encoder, void* UserData)
 {
 	if (bIsInitialized)
 	{
-		UE_LOG(LogProtoBridgeCore, Warning, TEXT("Performance Warning: RegisterVariantEncoder called after initialization. This triggers a full map copy under lock. Prefer registering encoders during module startup."));
+		UE_LOG(LogProtoBridgeCore, Warning, TEXT("Performance Warning: RegisterVariantEncoder called after initialization. This publishes a new encoder table. Prefer registering encoders during module startup."));
 	}
 
-	FWriteScopeLock Lock(StateLock);
-
-	TSharedPtr<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe> NewMap;
-	if (VariantEncoders.IsValid())
-	{
-		NewMap = MakeShared<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe>(*VariantEncoders);
-	}
-	else
+	PublishEncoders([Type, Encoder, UserData](FVariantEncoderTable& Table)
 	{
-		NewMap = MakeShared<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe>();
-	}
-	
-	NewMap->Add(Type, Encoder);
-	VariantEncoders = NewMap;
+		Table.Set(Type, Encoder, UserData);
+	});
 }
 
-void UProtoBridgeSubsystem::RegisterEncodersBatch(const TMap<EVariantTypes, FVariantEncoder>& InEncoders)
+void UProtoBridgeSubsystem::RegisterEncodersBatch(const FVariantEncoderTable& InEncoders)
 {
 	if (bIsInitialized)
 	{
-		UE_LOG(LogProtoBridgeCore, Warning, TEXT("Performance Warning: RegisterEncodersBatch called after initialization. This triggers a full map copy under lock."));
+		UE_LOG(LogProtoBridgeCore, Warning, TEXT("Performance Warning: RegisterEncodersBatch called after initialization. This publishes a new encoder table."));
 	}
 
-	FWriteScopeLock Lock(StateLock);
+	PublishEncoders([&InEncoders](FVariantEncoderTable& Table)
+	{
+		for (int32 Index = 0; Index < FVariantEncoderTable::NumTypes; ++Index)
+		{
+			if (InEncoders.Entries[Index].Func)
+			{
+				Table.Entries[Index] = InEncoders.Entries[Index];
+			}
+		}
+	});
+}
 
-	TSharedPtr<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe> NewMap;
-	if (VariantEncoders.IsValid())
+void UProtoBridgeSubsystem::PublishEncoders(TFunctionRef<void(FVariantEncoderTable&)> Mutate)
+{
+	FScopeLock Lock(&PublishLock);
+
+	TUniquePtr<FVariantEncoderTable> NewTable = MakeUnique<FVariantEncoderTable>();
+	if (ActiveEncoders)
 	{
-		NewMap = MakeShared<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe>(*VariantEncoders);
+		*NewTable = *ActiveEncoders;
 	}
-	else
+	Mutate(*NewTable);
+
+	ActiveEncoders = NewTable.Get();
+	PublishedEncoders.Add(MoveTemp(NewTable));
+	RebuildContextLocked();
+}
+
+void UProtoBridgeSubsystem::RebuildContextLocked()
+{
+	const UProtoBridgeCoreSettings* Settings = GetDefault<UProtoBridgeCoreSettings>();
+
+	FProtoSerializationContext NewContext;
+	NewContext.Int64Strategy = Int64Strategy;
+	NewContext.Encoders = ActiveEncoders;
+	NewContext.MaxAnyPayloadSize = Settings->MaxAnyPayloadSize;
+	NewContext.MaxByteArraySize = Settings->MaxByteArraySize;
+	NewContext.MaxJsonRecursionDepth = Settings->MaxJsonRecursionDepth;
+	NewContext.bBestEffortJsonParsing = Settings->bBestEffortJsonParsing;
+	NewContext.Version = GNextContextVersion.fetch_add(1, std::memory_order_relaxed) + 1;
+	ContextRebuildCount.fetch_add(1, std::memory_order_relaxed);
+
+	UE_LOG(LogProtoBridgeCore, Verbose, TEXT("Serialization context rebuilt (version %u)"), NewContext.Version);
+
+	ActiveContext = NewContext;
+	ActiveVersion.store(NewContext.Version, std::memory_order_release);
+}
+
+#if WITH_EDITOR
+void UProtoBridgeSubsystem::HandleSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	FScopeLock Lock(&PublishLock);
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UProtoBridgeCoreSettings, Int64SerializationStrategy))
 	{
-		NewMap = MakeShared<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe>();
+		Int64Strategy = CastChecked<UProtoBridgeCoreSettings>(Settings)->Int64SerializationStrategy;
 	}
-
-	NewMap->Append(InEncoders);
-	VariantEncoders = NewMap;
+	RebuildContextLocked();
 }
+#endif
 
 void UProtoBridgeSubsystem::SetInt64SerializationStrategy(EProtobufInt64Strategy InStrategy)
 {
-	FWriteScopeLock Lock(StateLock);
+	FScopeLock Lock(&PublishLock);
 	Int64Strategy = InStrategy;
+	RebuildContextLocked();
 }
 
 EProtobufInt64Strategy UProtoBridgeSubsystem::GetInt64SerializationStrategy() const
 {
-	FReadScopeLock Lock(StateLock);
-	return Int64Strategy;
+	return GetSerializationContext().Int64Strategy;
 }
 
 FProtoSerializationContext UProtoBridgeSubsystem::CreateSerializationContext() const
 {
-	FReadScopeLock Lock(StateLock);
-	const UProtoBridgeCoreSettings* Settings = GetDefault<UProtoBridgeCoreSettings>();
-	
-	FProtoSerializationContext Context;
-	Context.Int64Strategy = Int64Strategy;
-	Context.Encoders = VariantEncoders;
-	Context.MaxAnyPayloadSize = Settings->MaxAnyPayloadSize;
-	Context.MaxByteArraySize = Settings->MaxByteArraySize;
-	Context.MaxJsonRecursionDepth = Settings->MaxJsonRecursionDepth;
-	Context.bBestEffortJsonParsing = Settings->bBestEffortJsonParsing;
-	
-	return Context;
+	return GetSerializationContext();
+}
+
+const FProtoSerializationContext& UProtoBridgeSubsystem::GetSerializationContext() const
+{
+	struct FThreadContextCache
+	{
+		const UProtoBridgeSubsystem* Source = nullptr;
+		uint32 Version = 0;
+		FProtoSerializationContext Context;
+	};
+	static thread_local FThreadContextCache Cache;
+
+	if (Cache.Source != this || Cache.Version != ActiveVersion.load(std::memory_order_acquire))
+	{
+		FScopeLock Lock(&PublishLock);
+		Cache.Context = ActiveContext;
+		Cache.Source = this;
+		Cache.Version = ActiveContext.Version;
+	}
+	return Cache.Context;
+}
+
+uint32 UProtoBridgeSubsystem::GetContextRebuildCount() const
+{
+	return ContextRebuildCount.load(std::memory_order_relaxed);
 }
\ No newline at end of file
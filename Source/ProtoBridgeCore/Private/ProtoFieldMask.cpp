@@ -0,0 +1,145 @@
+﻿#include "ProtoFieldMask.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProtobufStringUtils.h"
+#include "ProtoBridgeLogs.h"
+
+struct FProtoFieldMask::FState
+{
+	TArray<FString> Paths;
+	FRWLock Lock;
+	TMap<const google::protobuf::Descriptor*, TUniquePtr<FProtoFieldMaskNode>> Compiled;
+};
+
+namespace
+{
+	void IncludeField(FProtoFieldMaskNode& Node, int32 FieldIndex, int32 FieldCount)
+	{
+		if (Node.Words.Num() == 0)
+		{
+			Node.Words.SetNumZeroed((FieldCount + 63) / 64);
+			Node.Children.SetNum(FieldCount);
+		}
+		Node.Words[FieldIndex / 64] |= 1ull << (FieldIndex % 64);
+	}
+
+	const google::protobuf::FieldDescriptor* FindField(const google::protobuf::Descriptor* Descriptor, const std::string& Segment)
+	{
+		const google::protobuf::FieldDescriptor* Field = Descriptor->FindFieldByName(Segment);
+		return Field ? Field : Descriptor->FindFieldByCamelcaseName(Segment);
+	}
+
+	void CompilePath(FProtoFieldMaskNode& Root, const google::protobuf::Descriptor* RootDescriptor, const FString& Path)
+	{
+		TArray<FString> Segments;
+		Path.ParseIntoArray(Segments, TEXT("."));
+
+		FProtoFieldMaskNode* Node = &Root;
+		const google::protobuf::Descriptor* Descriptor = RootDescriptor;
+		for (int32 Index = 0; Index < Segments.Num(); ++Index)
+		{
+			const google::protobuf::FieldDescriptor* Field = FindField(Descriptor, FProtobufStringUtils::FStringToStdString(Segments[Index]));
+			if (!Field)
+			{
+				UE_LOG(LogProtoBridgeCore, Warning, TEXT("Field mask path '%s' does not match a field of %hs"), *Path, std::string(Descriptor->full_name()).c_str());
+				return;
+			}
+
+			const int32 FieldIndex = Field->index();
+			const bool bWholeField = Node->Includes(FieldIndex) && !Node->GetChild(FieldIndex);
+			IncludeField(*Node, FieldIndex, Descriptor->field_count());
+
+			if (Index == Segments.Num() - 1)
+			{
+				Node->Children[FieldIndex].Reset();
+				return;
+			}
+			if (bWholeField)
+			{
+				return;
+			}
+			if (Field->is_repeated() || Field->type() != google::protobuf::FieldDescriptor::TYPE_MESSAGE)
+			{
+				UE_LOG(LogProtoBridgeCore, Warning, TEXT("Field mask path '%s' descends into non-message field %hs; selecting the whole field"), *Path, std::string(Field->full_name()).c_str());
+				Node->Children[FieldIndex].Reset();
+				return;
+			}
+
+			if (!Node->Children[FieldIndex])
+			{
+				Node->Children[FieldIndex] = MakeUnique<FProtoFieldMaskNode>();
+			}
+			Node = Node->Children[FieldIndex].Get();
+			Descriptor = Field->message_type();
+		}
+	}
+}
+
+FProtoFieldMask::FProtoFieldMask(TArray<FString> InPaths)
+	: State(MakeShared<FState, ESPMode::ThreadSafe>())
+{
+	State->Paths = MoveTemp(InPaths);
+}
+
+void FProtoFieldMask::FieldMaskToProto(const FProtoFieldMask& In, google::protobuf::FieldMask& Out)
+{
+	Out.clear_paths();
+	for (const FString& Path : In.GetPaths())
+	{
+		FProtobufStringUtils::FStringToStdString(Path, *Out.add_paths());
+	}
+}
+
+FProtoFieldMask FProtoFieldMask::ProtoToFieldMask(const google::protobuf::FieldMask& In)
+{
+	TArray<FString> Paths;
+	Paths.Reserve(In.paths_size());
+	for (const std::string& Path : In.paths())
+	{
+		Paths.Add(FProtobufStringUtils::StdStringToFString(Path));
+	}
+	return FProtoFieldMask(MoveTemp(Paths));
+}
+
+const TArray<FString>& FProtoFieldMask::GetPaths() const
+{
+	static const TArray<FString> EmptyPaths;
+	return State.IsValid() ? State->Paths : EmptyPaths;
+}
+
+const FProtoFieldMaskNode& FProtoFieldMask::Compile(const google::protobuf::Descriptor* Descriptor) const
+{
+	static const FProtoFieldMaskNode EmptyNode;
+	if (!State.IsValid() || !Descriptor) return EmptyNode;
+
+	{
+		FReadScopeLock ReadLock(State->Lock);
+		if (const TUniquePtr<FProtoFieldMaskNode>* Found = State->Compiled.Find(Descriptor))
+		{
+			return **Found;
+		}
+	}
+
+	FWriteScopeLock WriteLock(State->Lock);
+	TUniquePtr<FProtoFieldMaskNode>& Node = State->Compiled.FindOrAdd(Descriptor);
+	if (!Node)
+	{
+		Node = MakeUnique<FProtoFieldMaskNode>();
+		for (const FString& Path : State->Paths)
+		{
+			CompilePath(*Node, Descriptor, Path);
+		}
+	}
+	return *Node;
+}
+
+bool FProtoFieldMask::operator==(const FProtoFieldMask& Other) const
+{
+	const TArray<FString>& Paths = GetPaths();
+	const TArray<FString>& OtherPaths = Other.GetPaths();
+	if (Paths.Num() != OtherPaths.Num()) return false;
+	for (int32 Index = 0; Index < Paths.Num(); ++Index)
+	{
+		if (!Paths[Index].Equals(OtherPaths[Index], ESearchCase::CaseSensitive)) return false;
+	}
+	return true;
+}
\ No newline at end of file
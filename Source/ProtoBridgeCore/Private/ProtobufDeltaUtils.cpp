@@ -0,0 +1,45 @@
+﻿#include "ProtobufDeltaUtils.h"
+
+bool FProtobufDeltaUtils::WritePresenceMask(google::protobuf::Message& Proto, const uint64* Words, int32 NumWords)
+{
+	int32 UsedWords = NumWords;
+	while (UsedWords > 0 && Words[UsedWords - 1] == 0)
+	{
+		--UsedWords;
+	}
+
+	const bool bAnySet = UsedWords > 0;
+
+	// An unchanged delta still carries a zero word so ApplyDelta does not mistake it for a full snapshot.
+	google::protobuf::UnknownFieldSet* Unknown = Proto.GetReflection()->MutableUnknownFields(&Proto);
+	if (!bAnySet)
+	{
+		Unknown->AddVarint(PresenceFieldNumber, 0);
+	}
+	for (int32 Index = 0; Index < UsedWords; ++Index)
+	{
+		Unknown->AddVarint(PresenceFieldNumber, Words[Index]);
+	}
+	return bAnySet;
+}
+
+bool FProtobufDeltaUtils::ReadPresenceMask(const google::protobuf::Message& Proto, uint64* Words, int32 NumWords)
+{
+	FMemory::Memzero(Words, NumWords * sizeof(uint64));
+
+	const google::protobuf::UnknownFieldSet& Unknown = Proto.GetReflection()->GetUnknownFields(Proto);
+	bool bFound = false;
+	int32 WordIndex = 0;
+	for (int32 Index = 0; Index < Unknown.field_count(); ++Index)
+	{
+		const google::protobuf::UnknownField& Field = Unknown.field(Index);
+		if (Field.number() != PresenceFieldNumber || Field.type() != google::protobuf::UnknownField::TYPE_VARINT) continue;
+
+		bFound = true;
+		if (WordIndex < NumWords)
+		{
+			Words[WordIndex++] = Field.varint();
+		}
+	}
+	return bFound;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+﻿#include "ProtobufMathUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "ProtoBridgeLogs.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	TArray<FQuat> MakeRandomQuats(int32 Count)
+	{
+		FRandomStream Random(0x5EED);
+		TArray<FQuat> Quats;
+		Quats.Reserve(Count);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Quats.Add(FQuat(Random.FRandRange(-1.0, 1.0), Random.FRandRange(-1.0, 1.0), Random.FRandRange(-1.0, 1.0), Random.FRandRange(-1.0, 1.0)).GetNormalized());
+		}
+		return Quats;
+	}
+
+	void RunQuatCompressionBenchmark(const TArray<FString>& Args)
+	{
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+		const TArray<FQuat> Quats = MakeRandomQuats(Count);
+		TArray<uint64> Packed;
+		Packed.SetNumUninitialized(Count);
+		TArray<FQuat> Decoded;
+		Decoded.SetNumUninitialized(Count);
+
+		const double EncodeStart = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Packed[Index] = FProtobufMathUtils::CompressQuat(Quats[Index]);
+		}
+		const double EncodeSeconds = FPlatformTime::Seconds() - EncodeStart;
+
+		const double DecodeStart = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Decoded[Index] = FProtobufMathUtils::DecompressQuat(Packed[Index]);
+		}
+		const double DecodeSeconds = FPlatformTime::Seconds() - DecodeStart;
+
+		UE_LOG(LogProtoBridgeCore, Display, TEXT("Quat smallest-three: encode %.1f Mquat/s, decode %.1f Mquat/s, 8 bytes vs %d raw"),
+			Count / EncodeSeconds / 1.0e6, Count / DecodeSeconds / 1.0e6, static_cast<int32>(4 * sizeof(double)));
+	}
+
+	FAutoConsoleCommand QuatCompressionBenchmarkCommand(
+		TEXT("ProtoBridge.Benchmark.QuatCompression"),
+		TEXT("Measures smallest-three FQuat compression throughput on random rotations. Usage: ProtoBridge.Benchmark.QuatCompression [Count]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunQuatCompressionBenchmark));
+}
+
+#endif
\ No newline at end of file
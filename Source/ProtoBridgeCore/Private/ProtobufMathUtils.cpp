@@ -1,6 +1,7 @@
 ﻿#include "ProtobufMathUtils.h"
 #include "ProtobufIncludes.h"
 #include "ProtoBridgeLogs.h"
+#include "ProtoBridgeCoreSettings.h"
 
 bool FProtobufMathUtils::FDateTimeToTimestamp(const FDateTime& InDateTime, google::protobuf::Timestamp& OutTimestamp)
 {
@@ -86,4 +87,137 @@ bool FProtobufMathUtils::RepeatedFieldToFMatrix(const google::protobuf::Repeated
 	OutMatrix.M[3][0] = Data[12]; OutMatrix.M[3][1] = Data[13]; OutMatrix.M[3][2] = Data[14]; OutMatrix.M[3][3] = Data[15];
 	
 	return true;
+}
+
+int32 FProtobufMathUtils::GetQuantizedVectorScale()
+{
+	return GetDefault<UProtoBridgeCoreSettings>()->QuantizedVectorScale;
+}
+
+int32 FProtobufMathUtils::QuantizeComponent(double Value, int32 Scale)
+{
+	if (!FMath::IsFinite(Value)) return 0;
+	const double Scaled = FMath::RoundToDouble(Value * Scale);
+	return static_cast<int32>(FMath::Clamp(Scaled, static_cast<double>(MIN_int32), static_cast<double>(MAX_int32)));
+}
+
+double FProtobufMathUtils::DequantizeComponent(int32 Value, int32 Scale)
+{
+	return static_cast<double>(Value) / (Scale > 0 ? Scale : DefaultQuantizedVectorScale);
+}
+
+uint64 FProtobufMathUtils::PackRotatorAngles(const FRotator& In)
+{
+	return static_cast<uint64>(FRotator::CompressAxisToShort(In.Pitch))
+		| (static_cast<uint64>(FRotator::CompressAxisToShort(In.Yaw)) << 16)
+		| (static_cast<uint64>(FRotator::CompressAxisToShort(In.Roll)) << 32);
+}
+
+FRotator FProtobufMathUtils::UnpackRotatorAngles(uint64 Packed)
+{
+	return FRotator(
+		FRotator::DecompressAxisFromShort(static_cast<uint16>(Packed & 0xFFFF)),
+		FRotator::DecompressAxisFromShort(static_cast<uint16>((Packed >> 16) & 0xFFFF)),
+		FRotator::DecompressAxisFromShort(static_cast<uint16>((Packed >> 32) & 0xFFFF)));
+}
+
+namespace
+{
+	constexpr uint64 CompressedQuatComponentMask = (1ull << FProtobufMathUtils::CompressedQuatComponentBits) - 1;
+	constexpr int32 CompressedQuatIndexShift = 3 * FProtobufMathUtils::CompressedQuatComponentBits;
+	constexpr double CompressedQuatRange = UE_DOUBLE_INV_SQRT_2;
+}
+
+uint64 FProtobufMathUtils::CompressQuat(const FQuat& In)
+{
+	const double SizeSquared = In.SizeSquared();
+	if (!FMath::IsFinite(SizeSquared) || SizeSquared <= UE_SMALL_NUMBER)
+	{
+		return CompressQuat(FQuat::Identity);
+	}
+
+	const double InvSize = FMath::InvSqrt(SizeSquared);
+	const double Components[4] = { In.X * InvSize, In.Y * InvSize, In.Z * InvSize, In.W * InvSize };
+
+	int32 LargestIndex = 0;
+	for (int32 Index = 1; Index < 4; ++Index)
+	{
+		if (FMath::Abs(Components[Index]) > FMath::Abs(Components[LargestIndex]))
+		{
+			LargestIndex = Index;
+		}
+	}
+
+	const double Sign = Components[LargestIndex] < 0.0 ? -1.0 : 1.0;
+	uint64 Packed = static_cast<uint64>(LargestIndex) << CompressedQuatIndexShift;
+	int32 Shift = 0;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		if (Index == LargestIndex) continue;
+
+		const double Normalized = FMath::Clamp((Components[Index] * Sign / CompressedQuatRange) * 0.5 + 0.5, 0.0, 1.0);
+		Packed |= static_cast<uint64>(FMath::RoundToDouble(Normalized * CompressedQuatComponentMask)) << Shift;
+		Shift += CompressedQuatComponentBits;
+	}
+	return Packed;
+}
+
+FQuat FProtobufMathUtils::DecompressQuat(uint64 Packed)
+{
+	// Unit quaternions never pack to 0 (the three smallest would all sit at -1/sqrt(2)), so 0 is an unset field.
+	if (Packed == 0)
+	{
+		return FQuat::Identity;
+	}
+
+	const int32 LargestIndex = static_cast<int32>((Packed >> CompressedQuatIndexShift) & 3);
+	double Components[4];
+	double SumSquares = 0.0;
+	int32 Shift = 0;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		if (Index == LargestIndex) continue;
+
+		const double Normalized = static_cast<double>((Packed >> Shift) & CompressedQuatComponentMask) / CompressedQuatComponentMask;
+		Components[Index] = (Normalized * 2.0 - 1.0) * CompressedQuatRange;
+		SumSquares += Components[Index] * Components[Index];
+		Shift += CompressedQuatComponentBits;
+	}
+	Components[LargestIndex] = FMath::Sqrt(FMath::Max(0.0, 1.0 - SumSquares));
+
+	// Corrupt input can put the smallest three outside the unit sphere; renormalize so callers always get a rotation.
+	return FQuat(Components[0], Components[1], Components[2], Components[3]).GetNormalized();
+}
+
+void FProtobufMathUtils::FTransformArrayToPackedDoubles(const TArray<FTransform>& InTransforms, double* OutLocations, double* OutRotations, double* OutScales)
+{
+	static_assert(sizeof(FVector) == 3 * sizeof(double) && sizeof(FQuat) == 4 * sizeof(double), "Math types must be tightly packed doubles");
+
+	for (int32 Index = 0; Index < InTransforms.Num(); ++Index)
+	{
+		const FTransform& Transform = InTransforms[Index];
+		const FVector Location = Transform.GetLocation();
+		const FQuat Rotation = Transform.GetRotation();
+		const FVector Scale = Transform.GetScale3D();
+
+		FMemory::Memcpy(OutLocations + Index * 3, &Location, sizeof(FVector));
+		FMemory::Memcpy(OutRotations + Index * 4, &Rotation, sizeof(FQuat));
+		FMemory::Memcpy(OutScales + Index * 3, &Scale, sizeof(FVector));
+	}
+}
+
+void FProtobufMathUtils::PackedDoublesToFTransformArray(const double* InLocations, int32 NumLocations, const double* InRotations, int32 NumRotations, 
+	const double* InScales, int32 NumScales, TArray<FTransform>& OutTransforms)
+{
+	const int32 Count = FMath::Max3(NumLocations / 3, NumRotations / 4, NumScales / 3);
+	OutTransforms.Reset(Count);
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FVector Location = (Index + 1) * 3 <= NumLocations ? FVector(InLocations[Index * 3], InLocations[Index * 3 + 1], InLocations[Index * 3 + 2]) : FVector::ZeroVector;
+		const FQuat Rotation = (Index + 1) * 4 <= NumRotations ? FQuat(InRotations[Index * 4], InRotations[Index * 4 + 1], InRotations[Index * 4 + 2], InRotations[Index * 4 + 3]) : FQuat::Identity;
+		const FVector Scale = (Index + 1) * 3 <= NumScales ? FVector(InScales[Index * 3], InScales[Index * 3 + 1], InScales[Index * 3 + 2]) : FVector::OneVector;
+
+		OutTransforms.Emplace(Rotation, Location, Scale);
+	}
 }
\ No newline at end of file
@@ -6,11 +6,11 @@
 
 bool FProtobufReflectionUtils::FVariantToProtoValue(const FVariant& InVariant, google::protobuf::Value& OutValue, const FProtoSerializationContext& Context)
 {
-	if (Context.Encoders.IsValid())
+	if (Context.Encoders)
 	{
-		if (const auto* Encoder = Context.Encoders->Find(InVariant.GetType()))
+		if (const FVariantEncoder* Encoder = Context.Encoders->Find(InVariant.GetType()))
 		{
-			return (*Encoder)(InVariant, OutValue, Context);
+			return Encoder->Func(InVariant, OutValue, Context, Encoder->UserData);
 		}
 	}
 
@@ -18,6 +18,35 @@ bool FProtobufReflectionUtils::FVariantToProtoValue(const FVariant& InVariant, g
 	return false;
 }
 
+bool FProtobufReflectionUtils::EncodeVariants(TConstArrayView<FVariant> InVariants, google::protobuf::ListValue& OutList, const FProtoSerializationContext& Context)
+{
+	if (!Context.Encoders && InVariants.Num() > 0)
+	{
+		UE_LOG(LogProtoBridgeCore, Error, TEXT("EncodeVariants: No encoder table in context"));
+		return false;
+	}
+
+	google::protobuf::ListValue TempList;
+	TempList.mutable_values()->Reserve(InVariants.Num());
+	for (const FVariant& Variant : InVariants)
+	{
+		const FVariantEncoder* Encoder = Context.Encoders->Find(Variant.GetType());
+		if (!Encoder)
+		{
+			UE_LOG(LogProtoBridgeCore, Error, TEXT("EncodeVariants: Unsupported variant type: %d"), (int32)Variant.GetType());
+			return false;
+		}
+
+		if (!Encoder->Func(Variant, *TempList.add_values(), Context, Encoder->UserData))
+		{
+			return false;
+		}
+	}
+
+	OutList.Swap(&TempList);
+	return true;
+}
+
 FVariant FProtobufReflectionUtils::ProtoValueToFVariant(const google::protobuf::Value& InValue)
 {
 	switch (InValue.kind_case()) {
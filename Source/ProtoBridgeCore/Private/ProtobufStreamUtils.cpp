@@ -0,0 +1,113 @@
+﻿#include "ProtobufStreamUtils.h"
+#include "ProtoBridgeLogs.h"
+
+FProtoArchiveInputStream::FProtoArchiveInputStream(FArchive& InArchive, int64 InLength, int32 InBlockSize)
+	: Archive(InArchive)
+	, Remaining(InLength >= 0 ? InLength : FMath::Max<int64>(InArchive.TotalSize() - InArchive.Tell(), 0))
+	, Position(0)
+	, BufferUsed(0)
+	, BackUpCount(0)
+{
+	Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min<int64>(FMath::Max(InBlockSize, 1), FMath::Max<int64>(Remaining, 1))));
+}
+
+bool FProtoArchiveInputStream::Next(const void** Data, int* Size)
+{
+	if (BackUpCount > 0)
+	{
+		*Data = Buffer.GetData() + BufferUsed - BackUpCount;
+		*Size = BackUpCount;
+		Position += BackUpCount;
+		BackUpCount = 0;
+		return true;
+	}
+
+	if (Remaining <= 0 || Archive.IsError())
+	{
+		return false;
+	}
+
+	const int32 ChunkSize = static_cast<int32>(FMath::Min<int64>(Remaining, Buffer.Num()));
+	Archive.Serialize(Buffer.GetData(), ChunkSize);
+	if (Archive.IsError())
+	{
+		return false;
+	}
+
+	Remaining -= ChunkSize;
+	Position += ChunkSize;
+	BufferUsed = ChunkSize;
+
+	*Data = Buffer.GetData();
+	*Size = ChunkSize;
+	return true;
+}
+
+void FProtoArchiveInputStream::BackUp(int Count)
+{
+	check(Count >= 0 && BackUpCount + Count <= BufferUsed);
+	BackUpCount += Count;
+	Position -= Count;
+}
+
+bool FProtoArchiveInputStream::Skip(int Count)
+{
+	if (Count <= BackUpCount)
+	{
+		BackUpCount -= Count;
+		Position += Count;
+		return true;
+	}
+
+	int64 ToSkip = static_cast<int64>(Count) - BackUpCount;
+	Position += BackUpCount;
+	BackUpCount = 0;
+
+	const bool bHasEnough = ToSkip <= Remaining;
+	ToSkip = FMath::Min(ToSkip, Remaining);
+
+	Archive.Seek(Archive.Tell() + ToSkip);
+	Remaining -= ToSkip;
+	Position += ToSkip;
+	return bHasEnough && !Archive.IsError();
+}
+
+int64_t FProtoArchiveInputStream::ByteCount() const
+{
+	return Position;
+}
+
+bool FProtobufStreamUtils::ParseFromView(FMemoryView InView, google::protobuf::MessageLite& OutMessage)
+{
+	if (!CheckViewSize(InView)) return false;
+	return OutMessage.ParseFromArray(InView.GetData(), static_cast<int>(InView.GetSize()));
+}
+
+bool FProtobufStreamUtils::ParseFromArchive(FArchive& Ar, int64 Length, google::protobuf::MessageLite& OutMessage)
+{
+	FProtoArchiveInputStream Input(Ar, Length);
+	if (!CheckStreamSize(Input)) return false;
+
+	const int Size = static_cast<int>(Input.GetRemaining());
+	return OutMessage.ParseFromBoundedZeroCopyStream(&Input, Size) && !Ar.IsError();
+}
+
+bool FProtobufStreamUtils::CheckViewSize(FMemoryView InView)
+{
+	if (InView.GetSize() > static_cast<uint64>(MAX_int32))
+	{
+		UE_LOG(LogProtoBridgeCore, Error, TEXT("ParseFromView: Payload of %llu bytes exceeds the 2GB protobuf message limit"), InView.GetSize());
+		return false;
+	}
+	return true;
+}
+
+bool FProtobufStreamUtils::CheckStreamSize(const FProtoArchiveInputStream& Input)
+{
+	if (Input.GetRemaining() > static_cast<int64>(MAX_int32))
+	{
+		UE_LOG(LogProtoBridgeCore, Error, TEXT("ParseFromArchive: Payload of %lld bytes exceeds the 2GB protobuf message limit"), Input.GetRemaining());
+		return false;
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+﻿#include "ProtobufStringUtils.h"
+#include "Containers/StringConv.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "ProtoBridgeLogs.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	constexpr int32 CorpusLength = 4096;
+
+	FString MakeCorpus(int32 NonAsciiEvery, TCHAR FirstNonAscii, int32 NonAsciiRange)
+	{
+		FString Corpus;
+		Corpus.Reserve(CorpusLength);
+		for (int32 Index = 0; Index < CorpusLength; ++Index)
+		{
+			const bool bNonAscii = NonAsciiEvery > 0 && Index % NonAsciiEvery == 0;
+			Corpus.AppendChar(bNonAscii ? static_cast<TCHAR>(FirstNonAscii + Index % NonAsciiRange) : static_cast<TCHAR>(TEXT('a') + Index % 26));
+		}
+		return Corpus;
+	}
+
+	template <typename T_Func>
+	double TimeIterations(int32 Iterations, T_Func&& Func)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Func();
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	}
+
+	void RunCorpus(const TCHAR* Name, const FString& Corpus, int32 Iterations)
+	{
+		std::string Utf8;
+		FString Wide;
+		uint64 Checksum = 0;
+
+		const double BaselineEncode = TimeIterations(Iterations, [&]()
+		{
+			const int32 DestLen = FTCHARToUTF8_Convert::ConvertedLength(*Corpus, Corpus.Len());
+			Utf8.resize(DestLen);
+			FTCHARToUTF8_Convert::Convert(&Utf8[0], DestLen, *Corpus, Corpus.Len());
+			Checksum += Utf8.size();
+		});
+		const double FastEncode = TimeIterations(Iterations, [&]()
+		{
+			FProtobufStringUtils::FStringToStdString(Corpus, Utf8);
+			Checksum += Utf8.size();
+		});
+
+		const double BaselineDecode = TimeIterations(Iterations, [&]()
+		{
+			const int32 DestLen = FUTF8ToTCHAR_Convert::ConvertedLength(Utf8.data(), static_cast<int32>(Utf8.size()));
+			TArray<TCHAR>& Chars = Wide.GetCharArray();
+			Chars.SetNumUninitialized(DestLen + 1);
+			FUTF8ToTCHAR_Convert::Convert(Chars.GetData(), DestLen, Utf8.data(), static_cast<int32>(Utf8.size()));
+			Chars[DestLen] = 0;
+			Checksum += Wide.Len();
+		});
+		const double FastDecode = TimeIterations(Iterations, [&]()
+		{
+			FProtobufStringUtils::StdStringToFString(Utf8, Wide);
+			Checksum += Wide.Len();
+		});
+
+		const double Megabytes = static_cast<double>(Utf8.size()) * Iterations / (1024.0 * 1024.0);
+		UE_LOG(LogProtoBridgeCore, Display, TEXT("%-8s UTF-16->UTF-8: %8.1f MB/s (baseline %8.1f MB/s)  UTF-8->UTF-16: %8.1f MB/s (baseline %8.1f MB/s)  [checksum %llu]"),
+			Name, Megabytes / FastEncode, Megabytes / BaselineEncode, Megabytes / FastDecode, Megabytes / BaselineDecode, Checksum);
+	}
+
+	void RunStringBenchmark(const TArray<FString>& Args)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+
+		RunCorpus(TEXT("ASCII"), MakeCorpus(0, 0, 1), Iterations);
+		RunCorpus(TEXT("Latin-1"), MakeCorpus(6, 0x00C0, 0x40), Iterations);
+		RunCorpus(TEXT("CJK"), MakeCorpus(1, 0x4E00, 0x5000), Iterations);
+	}
+
+	FAutoConsoleCommand StringBenchmarkCommand(
+		TEXT("ProtoBridge.Benchmark.Strings"),
+		TEXT("Measures FProtobufStringUtils UTF-16/UTF-8 transcoding against the engine converters on ASCII, Latin-1 and CJK corpora. Usage: ProtoBridge.Benchmark.Strings [Iterations]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunStringBenchmark));
+}
+
+#endif
\ No newline at end of file
@@ -1,10 +1,280 @@
 ﻿#include "ProtobufStringUtils.h"
+#include "ProtoBridgeNameCache.h"
 #include "Containers/StringConv.h"
 #include "Misc/StringBuilder.h"
 #include "ProtoBridgeLogs.h"
+#include "ProtoBridgeMemory.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+	#define PROTOBRIDGE_TRANSCODE_SSE2 1
+	#include <emmintrin.h>
+	#if PLATFORM_ALWAYS_HAS_AVX_2
+		#define PROTOBRIDGE_TRANSCODE_AVX2 1
+		#include <immintrin.h>
+	#endif
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+	#define PROTOBRIDGE_TRANSCODE_NEON 1
+	#include <arm_neon.h>
+#endif
+
+#ifndef PROTOBRIDGE_TRANSCODE_SSE2
+	#define PROTOBRIDGE_TRANSCODE_SSE2 0
+#endif
+#ifndef PROTOBRIDGE_TRANSCODE_AVX2
+	#define PROTOBRIDGE_TRANSCODE_AVX2 0
+#endif
+#ifndef PROTOBRIDGE_TRANSCODE_NEON
+	#define PROTOBRIDGE_TRANSCODE_NEON 0
+#endif
 
 namespace
 {
+	constexpr bool bTCharIsUtf16 = sizeof(TCHAR) == sizeof(uint16);
+	constexpr uint8 BogusChar = '?';
+
+	/** Length of the leading ASCII run in Src; with bStore it is also narrowed into Dest. */
+	template <bool bStore = true>
+	FORCEINLINE int32 NarrowAsciiRun(const uint16* Src, int32 Count, uint8* Dest)
+	{
+		int32 Index = 0;
+#if PROTOBRIDGE_TRANSCODE_AVX2
+		const __m256i WideMask = _mm256_set1_epi16(static_cast<short>(0xFF80));
+		for (; Index + 32 <= Count; Index += 32)
+		{
+			const __m256i Low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Src + Index));
+			const __m256i High = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Src + Index + 16));
+			if (!_mm256_testz_si256(_mm256_or_si256(Low, High), WideMask)) break;
+			if constexpr (bStore)
+			{
+				const __m256i Packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(Low, High), 0xD8);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dest + Index), Packed);
+			}
+		}
+#endif
+#if PROTOBRIDGE_TRANSCODE_SSE2
+		const __m128i Mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+		const __m128i Zero = _mm_setzero_si128();
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const __m128i Low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + Index));
+			const __m128i High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + Index + 8));
+			const __m128i NonAscii = _mm_and_si128(_mm_or_si128(Low, High), Mask);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi16(NonAscii, Zero)) != 0xFFFF) break;
+			if constexpr (bStore)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index), _mm_packus_epi16(Low, High));
+			}
+		}
+#elif PROTOBRIDGE_TRANSCODE_NEON
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const uint16x8_t Low = vld1q_u16(Src + Index);
+			const uint16x8_t High = vld1q_u16(Src + Index + 8);
+			if (vmaxvq_u16(vorrq_u16(Low, High)) >= 0x80) break;
+			if constexpr (bStore)
+			{
+				vst1q_u8(Dest + Index, vcombine_u8(vmovn_u16(Low), vmovn_u16(High)));
+			}
+		}
+#endif
+		for (; Index < Count && Src[Index] < 0x80; ++Index)
+		{
+			if constexpr (bStore)
+			{
+				Dest[Index] = static_cast<uint8>(Src[Index]);
+			}
+		}
+		return Index;
+	}
+
+	FORCEINLINE int32 WidenAsciiRun(const uint8* Src, int32 Count, uint16* Dest)
+	{
+		int32 Index = 0;
+#if PROTOBRIDGE_TRANSCODE_AVX2
+		for (; Index + 32 <= Count; Index += 32)
+		{
+			const __m256i Bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Src + Index));
+			if (_mm256_movemask_epi8(Bytes) != 0) break;
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dest + Index), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(Bytes)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dest + Index + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(Bytes, 1)));
+		}
+#endif
+#if PROTOBRIDGE_TRANSCODE_SSE2
+		const __m128i Zero = _mm_setzero_si128();
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + Index));
+			if (_mm_movemask_epi8(Bytes) != 0) break;
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index), _mm_unpacklo_epi8(Bytes, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index + 8), _mm_unpackhi_epi8(Bytes, Zero));
+		}
+#elif PROTOBRIDGE_TRANSCODE_NEON
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const uint8x16_t Bytes = vld1q_u8(Src + Index);
+			if (vmaxvq_u8(Bytes) >= 0x80) break;
+			vst1q_u16(Dest + Index, vmovl_u8(vget_low_u8(Bytes)));
+			vst1q_u16(Dest + Index + 8, vmovl_u8(vget_high_u8(Bytes)));
+		}
+#endif
+		for (; Index < Count && Src[Index] < 0x80; ++Index)
+		{
+			Dest[Index] = Src[Index];
+		}
+		return Index;
+	}
+
+	/** Dest must hold 3 * Count bytes, or exactly Utf16ToUtf8Length(Src, Count). Unpaired surrogates become BogusChar. */
+	int32 Utf16ToUtf8(const uint16* Src, int32 Count, uint8* Dest)
+	{
+		int32 In = 0;
+		int32 Out = 0;
+		while (In < Count)
+		{
+			const int32 Run = NarrowAsciiRun(Src + In, Count - In, Dest + Out);
+			In += Run;
+			Out += Run;
+			if (In >= Count) break;
+
+			const uint32 Unit = Src[In++];
+			if (Unit < 0x800)
+			{
+				Dest[Out++] = static_cast<uint8>(0xC0 | (Unit >> 6));
+				Dest[Out++] = static_cast<uint8>(0x80 | (Unit & 0x3F));
+			}
+			else if (Unit < 0xD800 || Unit > 0xDFFF)
+			{
+				Dest[Out++] = static_cast<uint8>(0xE0 | (Unit >> 12));
+				Dest[Out++] = static_cast<uint8>(0x80 | ((Unit >> 6) & 0x3F));
+				Dest[Out++] = static_cast<uint8>(0x80 | (Unit & 0x3F));
+			}
+			else if (Unit <= 0xDBFF && In < Count && Src[In] >= 0xDC00 && Src[In] <= 0xDFFF)
+			{
+				const uint32 CodePoint = 0x10000 + ((Unit - 0xD800) << 10) + (Src[In++] - 0xDC00);
+				Dest[Out++] = static_cast<uint8>(0xF0 | (CodePoint >> 18));
+				Dest[Out++] = static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F));
+				Dest[Out++] = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+				Dest[Out++] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+			}
+			else
+			{
+				Dest[Out++] = BogusChar;
+			}
+		}
+		return Out;
+	}
+
+	/** Dest must hold Count units. Malformed, overlong and surrogate sequences become BogusChar. */
+	int32 Utf8ToUtf16(const uint8* Src, int32 Count, uint16* Dest)
+	{
+		static constexpr uint32 MinCodePoint[4] = { 0, 0x80, 0x800, 0x10000 };
+
+		int32 In = 0;
+		int32 Out = 0;
+		while (In < Count)
+		{
+			const int32 Run = WidenAsciiRun(Src + In, Count - In, Dest + Out);
+			In += Run;
+			Out += Run;
+			if (In >= Count) break;
+
+			const uint8 Lead = Src[In];
+			uint32 CodePoint = 0;
+			int32 Extra = 0;
+			if ((Lead & 0xE0) == 0xC0)
+			{
+				CodePoint = Lead & 0x1F;
+				Extra = 1;
+			}
+			else if ((Lead & 0xF0) == 0xE0)
+			{
+				CodePoint = Lead & 0x0F;
+				Extra = 2;
+			}
+			else if ((Lead & 0xF8) == 0xF0)
+			{
+				CodePoint = Lead & 0x07;
+				Extra = 3;
+			}
+
+			bool bValid = Extra > 0 && In + Extra < Count;
+			for (int32 Offset = 1; bValid && Offset <= Extra; ++Offset)
+			{
+				const uint8 Continuation = Src[In + Offset];
+				bValid = (Continuation & 0xC0) == 0x80;
+				CodePoint = (CodePoint << 6) | (Continuation & 0x3F);
+			}
+
+			if (!bValid || CodePoint < MinCodePoint[Extra] || CodePoint > 0x10FFFF || (CodePoint >= 0xD800 && CodePoint <= 0xDFFF))
+			{
+				Dest[Out++] = BogusChar;
+				++In;
+				continue;
+			}
+
+			In += Extra + 1;
+			if (CodePoint >= 0x10000)
+			{
+				Dest[Out++] = static_cast<uint16>(0xD800 + ((CodePoint - 0x10000) >> 10));
+				Dest[Out++] = static_cast<uint16>(0xDC00 + (CodePoint & 0x3FF));
+			}
+			else
+			{
+				Dest[Out++] = static_cast<uint16>(CodePoint);
+			}
+		}
+		return Out;
+	}
+
+	/** Exactly the number of bytes Utf16ToUtf8 writes for Src. */
+	int32 Utf16ToUtf8Length(const uint16* Src, int32 Count)
+	{
+		int32 In = 0;
+		int32 Out = 0;
+		while (In < Count)
+		{
+			const int32 Run = NarrowAsciiRun<false>(Src + In, Count - In, nullptr);
+			In += Run;
+			Out += Run;
+			if (In >= Count) break;
+
+			const uint32 Unit = Src[In++];
+			if (Unit < 0x800)
+			{
+				Out += 2;
+			}
+			else if (Unit < 0xD800 || Unit > 0xDFFF)
+			{
+				Out += 3;
+			}
+			else if (Unit <= 0xDBFF && In < Count && Src[In] >= 0xDC00 && Src[In] <= 0xDFFF)
+			{
+				++In;
+				Out += 4;
+			}
+			else
+			{
+				Out += 1;
+			}
+		}
+		return Out;
+	}
+
+	/** Dest must hold InLen characters; returns the number written. */
+	int32 ConvertUtf8ToTChar(const char* InData, int32 InLen, TCHAR* Dest)
+	{
+		if constexpr (bTCharIsUtf16)
+		{
+			return Utf8ToUtf16(reinterpret_cast<const uint8*>(InData), InLen, reinterpret_cast<uint16*>(Dest));
+		}
+		else
+		{
+			const int32 DestLen = FUTF8ToTCHAR_Convert::ConvertedLength(InData, InLen);
+			FUTF8ToTCHAR_Convert::Convert(Dest, DestLen, InData, InLen);
+			return DestLen;
+		}
+	}
+
 	void ConvertTCharToStdString(const TCHAR* InData, int32 InLen, std::string& OutStr)
 	{
 		if (InLen <= 0)
@@ -12,9 +282,28 @@ namespace
 			OutStr.clear();
 			return;
 		}
-		const int32 DestLen = FTCHARToUTF8_Convert::ConvertedLength(InData, InLen);
-		OutStr.resize(DestLen);
-		FTCHARToUTF8_Convert::Convert(&OutStr[0], DestLen, InData, InLen);
+
+		if constexpr (bTCharIsUtf16)
+		{
+			const uint16* Src = reinterpret_cast<const uint16*>(InData);
+			OutStr.resize(InLen);
+			const int32 AsciiLen = NarrowAsciiRun(Src, InLen, reinterpret_cast<uint8*>(&OutStr[0]));
+			if (AsciiLen == InLen)
+			{
+				return;
+			}
+
+			const int32 Remaining = InLen - AsciiLen;
+			OutStr.resize(static_cast<size_t>(AsciiLen) + static_cast<size_t>(Remaining) * 3);
+			const int32 Written = Utf16ToUtf8(Src + AsciiLen, Remaining, reinterpret_cast<uint8*>(&OutStr[AsciiLen]));
+			OutStr.resize(static_cast<size_t>(AsciiLen) + Written);
+		}
+		else
+		{
+			const int32 DestLen = FTCHARToUTF8_Convert::ConvertedLength(InData, InLen);
+			OutStr.resize(DestLen);
+			FTCHARToUTF8_Convert::Convert(&OutStr[0], DestLen, InData, InLen);
+		}
 	}
 
 	void ConvertUtf8ToTCharArray(const char* InData, int32 InLen, TArray<TCHAR>& OutArray)
@@ -24,15 +313,16 @@ namespace
 			OutArray.Empty();
 			return;
 		}
-		const int32 DestLen = FUTF8ToTCHAR_Convert::ConvertedLength(InData, InLen);
+		OutArray.SetNumUninitialized(InLen + 1);
+		const int32 DestLen = ConvertUtf8ToTChar(InData, InLen, OutArray.GetData());
 		OutArray.SetNumUninitialized(DestLen + 1);
-		FUTF8ToTCHAR_Convert::Convert(OutArray.GetData(), DestLen, InData, InLen);
 		OutArray[DestLen] = 0;
 	}
 }
 
 void FProtobufStringUtils::FStringToStdString(FStringView InStr, std::string& OutStr)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 	ConvertTCharToStdString(InStr.GetData(), InStr.Len(), OutStr);
 }
 
@@ -45,6 +335,7 @@ std::string FProtobufStringUtils::FStringToStdString(FStringView InStr)
 
 void FProtobufStringUtils::StdStringToFString(const std::string& InStr, FString& OutStr)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Decode);
 	if (InStr.empty())
 	{
 		OutStr.Empty();
@@ -60,8 +351,57 @@ FString FProtobufStringUtils::StdStringToFString(const std::string& InStr)
 	return Result;
 }
 
+void FProtobufStringUtils::Utf8ToFString(const ANSICHAR* InData, int32 InLen, FString& OutStr)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Decode);
+	if (InLen <= 0)
+	{
+		OutStr.Reset();
+		return;
+	}
+	ConvertUtf8ToTCharArray(InData, InLen, OutStr.GetCharArray());
+}
+
+int32 FProtobufStringUtils::Utf8Length(FStringView InStr)
+{
+	if (InStr.Len() <= 0)
+	{
+		return 0;
+	}
+
+	if constexpr (bTCharIsUtf16)
+	{
+		return Utf16ToUtf8Length(reinterpret_cast<const uint16*>(InStr.GetData()), InStr.Len());
+	}
+	else
+	{
+		return FTCHARToUTF8_Convert::ConvertedLength(InStr.GetData(), InStr.Len());
+	}
+}
+
+int32 FProtobufStringUtils::FStringToUtf8(FStringView InStr, ANSICHAR* Dest)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Encode);
+	if (InStr.Len() <= 0)
+	{
+		return 0;
+	}
+
+	if constexpr (bTCharIsUtf16)
+	{
+		return Utf16ToUtf8(reinterpret_cast<const uint16*>(InStr.GetData()), InStr.Len(), reinterpret_cast<uint8*>(Dest));
+	}
+	else
+	{
+		const int32 DestLen = FTCHARToUTF8_Convert::ConvertedLength(InStr.GetData(), InStr.Len());
+		FTCHARToUTF8_Convert::Convert(Dest, DestLen, InStr.GetData(), InStr.Len());
+		return DestLen;
+	}
+}
+
 void FProtobufStringUtils::FNameToStdString(const FName& InName, std::string& OutStr)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 	if (InName.IsNone())
 	{
 		OutStr.clear();
@@ -82,39 +422,43 @@ std::string FProtobufStringUtils::FNameToStdString(const FName& InName)
 
 void FProtobufStringUtils::StdStringToFName(const std::string& InStr, FName& OutName)
 {
-	if (InStr.empty())
+	LLM_SCOPE_BYTAG(ProtoBridge_Decode);
+	OutName = FProtoBridgeNameCache::ResolveName(InStr.data(), static_cast<int32>(InStr.length()));
+}
+
+FName FProtobufStringUtils::StdStringToFName(const std::string& InStr)
+{
+	FName Result;
+	StdStringToFName(InStr, Result);
+	return Result;
+}
+
+FName FProtobufStringUtils::Utf8ToFName(const ANSICHAR* InData, int32 InLen)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Decode);
+	if (InLen <= 0)
 	{
-		OutName = NAME_None;
-		return;
+		return NAME_None;
 	}
 
-	if (InStr.length() > NAME_SIZE)
+	if (InLen > NAME_SIZE)
 	{
-		UE_LOG(LogProtoBridgeCore, Warning, TEXT("StdStringToFName: String length %llu exceeds NAME_SIZE. Returning NAME_None."), (uint64)InStr.length());
-		OutName = NAME_None;
-		return;
+		UE_LOG(LogProtoBridgeCore, Warning, TEXT("Utf8ToFName: String length %d exceeds NAME_SIZE. Returning NAME_None."), InLen);
+		return NAME_None;
 	}
 
-	const int32 SrcLen = static_cast<int32>(InStr.length());
-	const int32 DestLen = FUTF8ToTCHAR_Convert::ConvertedLength(InStr.data(), SrcLen);
-
 	TStringBuilder<NAME_SIZE> Builder;
-	Builder.AddUninitialized(DestLen);
+	Builder.AddUninitialized(InLen);
 
-	FUTF8ToTCHAR_Convert::Convert(Builder.GetData(), DestLen, InStr.data(), SrcLen);
+	const int32 DestLen = ConvertUtf8ToTChar(InData, InLen, Builder.GetData());
+	Builder.RemoveSuffix(InLen - DestLen);
 	
-	OutName = FName(Builder.GetData());
-}
-
-FName FProtobufStringUtils::StdStringToFName(const std::string& InStr)
-{
-	FName Result;
-	StdStringToFName(InStr, Result);
-	return Result;
+	return FName(Builder.ToString());
 }
 
 void FProtobufStringUtils::FTextToStdString(const FText& InText, std::string& OutStr)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 	FStringToStdString(InText.ToString(), OutStr);
 }
 
@@ -127,6 +471,7 @@ std::string FProtobufStringUtils::FTextToStdString(const FText& InText)
 
 void FProtobufStringUtils::StdStringToFText(const std::string& InStr, FText& OutText)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Decode);
 	FString Str;
 	StdStringToFString(InStr, Str);
 	OutText = FText::FromString(MoveTemp(Str));
@@ -141,6 +486,7 @@ FText FProtobufStringUtils::StdStringToFText(const std::string& InStr)
 
 void FProtobufStringUtils::FGuidToStdString(const FGuid& InGuid, std::string& OutStr)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 	if (!InGuid.IsValid())
 	{
 		OutStr.clear();
@@ -168,12 +514,12 @@ void FProtobufStringUtils::StdStringToFGuid(const std::string& InStr, FGuid& Out
 	}
 
 	const int32 SrcLen = static_cast<int32>(InStr.length());
-	const int32 DestLen = FUTF8ToTCHAR_Convert::ConvertedLength(InStr.data(), SrcLen);
 
 	TStringBuilder<64> Builder;
-	Builder.AddUninitialized(DestLen);
+	Builder.AddUninitialized(SrcLen);
 
-	FUTF8ToTCHAR_Convert::Convert(Builder.GetData(), DestLen, InStr.data(), SrcLen);
+	const int32 DestLen = ConvertUtf8ToTChar(InStr.data(), SrcLen, Builder.GetData());
+	Builder.RemoveSuffix(SrcLen - DestLen);
 
 	if (!FGuid::Parse(FStringView(Builder.GetData(), DestLen), OutGuid))
 	{
@@ -191,6 +537,7 @@ FGuid FProtobufStringUtils::StdStringToFGuid(const std::string& InStr)
 
 void FProtobufStringUtils::ByteArrayToStdString(const TArray<uint8>& InBytes, std::string& OutStr)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 	if (InBytes.Num() > 0)
 	{
 		OutStr.assign(reinterpret_cast<const char*>(InBytes.GetData()), InBytes.Num());
@@ -203,6 +550,7 @@ void FProtobufStringUtils::ByteArrayToStdString(const TArray<uint8>& InBytes, st
 
 bool FProtobufStringUtils::StdStringToByteArray(const std::string& InStr, TArray<uint8>& OutBytes, const FProtoSerializationContext& Context)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Decode);
 	const int32 MaxSize = Context.MaxByteArraySize;
 	
 	if (InStr.size() > static_cast<size_t>(MaxSize))
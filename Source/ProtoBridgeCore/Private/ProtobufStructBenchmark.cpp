@@ -0,0 +1,113 @@
+﻿#include "ProtobufStructUtils.h"
+#include "ProtobufIncludes.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "ProtoBridgeLogs.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	void AddRecord(google::protobuf::ListValue& Records, int32 Index, FRandomStream& Random)
+	{
+		google::protobuf::Struct* Record = Records.add_values()->mutable_struct_value();
+		auto& Fields = *Record->mutable_fields();
+		Fields["id"].set_number_value(Index);
+		Fields["name"].set_string_value("entity_" + std::to_string(Index));
+		Fields["active"].set_bool_value(Random.FRand() > 0.5f);
+		Fields["score"].set_number_value(Random.FRandRange(-1000.0, 1000.0));
+		Fields["owner"].set_null_value(google::protobuf::NULL_VALUE);
+
+		auto& Position = *Fields["position"].mutable_struct_value()->mutable_fields();
+		Position["x"].set_number_value(Random.FRandRange(-1.0e5, 1.0e5));
+		Position["y"].set_number_value(Random.FRandRange(-1.0e5, 1.0e5));
+		Position["z"].set_number_value(Random.FRandRange(-1.0e5, 1.0e5));
+
+		google::protobuf::ListValue* Tags = Fields["tags"].mutable_list_value();
+		Tags->add_values()->set_string_value("telemetry");
+		Tags->add_values()->set_string_value("sample");
+	}
+
+	bool MakeDocument(int64 TargetBytes, TArray<uint8>& OutUtf8, const FProtoSerializationContext& Context)
+	{
+		constexpr int32 ApproxRecordBytes = 200;
+		const int32 RecordCount = static_cast<int32>(FMath::Max<int64>(1, TargetBytes / ApproxRecordBytes));
+
+		FRandomStream Random(0x5EED);
+		google::protobuf::Struct Document;
+		google::protobuf::ListValue* Records = (*Document.mutable_fields())["records"].mutable_list_value();
+		for (int32 Index = 0; Index < RecordCount; ++Index)
+		{
+			AddRecord(*Records, Index, Random);
+		}
+		return FProtobufStructUtils::ProtoStructToJsonString(Document, OutUtf8, Context);
+	}
+
+	void RunStructJsonBenchmark(const TArray<FString>& Args)
+	{
+		TArray<int32> SizesMb;
+		for (const FString& Arg : Args)
+		{
+			SizesMb.Add(FMath::Clamp(FCString::Atoi(*Arg), 1, 50));
+		}
+		if (SizesMb.IsEmpty())
+		{
+			SizesMb = { 1, 10, 50 };
+		}
+
+		const FProtoSerializationContext Context;
+		for (const int32 SizeMb : SizesMb)
+		{
+			TArray<uint8> Utf8;
+			if (!MakeDocument(static_cast<int64>(SizeMb) * 1024 * 1024, Utf8, Context))
+			{
+				UE_LOG(LogProtoBridgeCore, Error, TEXT("Struct JSON: failed to build a %d MB document"), SizeMb);
+				continue;
+			}
+			const FUtf8StringView View(reinterpret_cast<const UTF8CHAR*>(Utf8.GetData()), Utf8.Num());
+			const double Megabytes = Utf8.Num() / (1024.0 * 1024.0);
+
+			const double DomStart = FPlatformTime::Seconds();
+			google::protobuf::Struct DomStruct;
+			{
+				const FString Text(View);
+				TSharedPtr<FJsonObject> JsonObject;
+				if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), JsonObject) ||
+					!FProtobufStructUtils::JsonObjectToProtoStruct(JsonObject, DomStruct, Context))
+				{
+					UE_LOG(LogProtoBridgeCore, Error, TEXT("Struct JSON: DOM path failed on %.1f MB"), Megabytes);
+					continue;
+				}
+			}
+			const double DomSeconds = FPlatformTime::Seconds() - DomStart;
+
+			const double StreamStart = FPlatformTime::Seconds();
+			google::protobuf::Struct StreamStruct;
+			if (!FProtobufStructUtils::JsonStringToProtoStruct(View, StreamStruct, Context))
+			{
+				UE_LOG(LogProtoBridgeCore, Error, TEXT("Struct JSON: streaming path failed on %.1f MB"), Megabytes);
+				continue;
+			}
+			const double StreamSeconds = FPlatformTime::Seconds() - StreamStart;
+
+			UE_LOG(LogProtoBridgeCore, Display, TEXT("Struct JSON %.1f MB: DOM %.1f MB/s, streaming %.1f MB/s (%.2fx)"),
+				Megabytes, Megabytes / DomSeconds, Megabytes / StreamSeconds, DomSeconds / StreamSeconds);
+
+			if (DomStruct.ByteSizeLong() != StreamStruct.ByteSizeLong())
+			{
+				UE_LOG(LogProtoBridgeCore, Error, TEXT("Struct JSON %.1f MB: DOM and streaming results differ in size (%llu vs %llu bytes)"),
+					Megabytes, static_cast<uint64>(DomStruct.ByteSizeLong()), static_cast<uint64>(StreamStruct.ByteSizeLong()));
+			}
+		}
+	}
+
+	FAutoConsoleCommand StructJsonBenchmarkCommand(
+		TEXT("ProtoBridge.Benchmark.StructJson"),
+		TEXT("Compares JsonStringToProtoStruct against the FJsonObject DOM path on synthetic telemetry documents. Usage: ProtoBridge.Benchmark.StructJson [SizeMb...] (1-50, default 1 10 50)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunStructJsonBenchmark));
+}
+
+#endif
\ No newline at end of file
@@ -3,8 +3,490 @@
 #include "ProtobufIncludes.h"
 #include "ProtobufReflectionUtils.h"
 #include "ProtoBridgeLogs.h"
+#include "ProtoBridgeMemory.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/JsonReader.h"
 #include <cmath>
 
+namespace
+{
+	/** Work stack shared by every conversion direction; nesting lives on the heap instead of the call stack. */
+	template <typename FrameType>
+	using TConversionStack = TArray<FrameType, TInlineAllocator<16>>;
+
+	enum class EConversionStep : uint8
+	{
+		Succeeded,
+		Failed,
+		Descended
+	};
+
+	struct FProtoCursor
+	{
+		const google::protobuf::Struct* Struct = nullptr;
+		const google::protobuf::ListValue* List = nullptr;
+		google::protobuf::Map<std::string, google::protobuf::Value>::const_iterator FieldIt;
+		int32 ItemIndex = 0;
+		int32 Depth = 0;
+
+		FProtoCursor(const google::protobuf::Struct& InStruct, int32 InDepth)
+			: Struct(&InStruct), FieldIt(InStruct.fields().begin()), Depth(InDepth)
+		{}
+
+		FProtoCursor(const google::protobuf::ListValue& InList, int32 InDepth)
+			: List(&InList), Depth(InDepth)
+		{}
+
+		const google::protobuf::Value* Next(const std::string*& OutKey)
+		{
+			if (Struct)
+			{
+				if (FieldIt == Struct->fields().end())
+				{
+					return nullptr;
+				}
+				OutKey = &FieldIt->first;
+				return &(FieldIt++)->second;
+			}
+			return ItemIndex < List->values_size() ? &List->values(ItemIndex++) : nullptr;
+		}
+	};
+
+	struct FProtoToJsonFrame
+	{
+		FProtoCursor Cursor;
+		TSharedPtr<FJsonObject> Object;
+		TArray<TSharedPtr<FJsonValue>> Items;
+		FString Key;
+
+		template <typename SourceType>
+		FProtoToJsonFrame(const SourceType& InSource, int32 InDepth)
+			: Cursor(InSource, InDepth)
+		{}
+	};
+
+	struct FJsonToProtoFrame
+	{
+		google::protobuf::Struct* Struct = nullptr;
+		google::protobuf::ListValue* List = nullptr;
+		TOptional<TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator> FieldIt;
+		const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+		int32 ItemIndex = 0;
+		int32 Depth = 0;
+		const FString* JsonKey = nullptr;
+		std::string Key;
+	};
+
+	struct FJsonParseFrame
+	{
+		google::protobuf::Struct* Struct = nullptr;
+		google::protobuf::ListValue* List = nullptr;
+		std::string Key;
+		int32 Depth = 0;
+	};
+
+	bool JsonNumberToProtoValue(double Val, google::protobuf::Value& OutValue, const FProtoSerializationContext& Context)
+	{
+		if (Val >= static_cast<double>(ProtoBridgeConstants::MinSafeInteger) && 
+			Val <= static_cast<double>(ProtoBridgeConstants::MaxSafeInteger) &&
+			FMath::Floor(Val) == Val)
+		{
+			const int64 IntVal = static_cast<int64>(Val);
+			if (FProtobufReflectionUtils::ConvertInt64ToProtoValue(IntVal, OutValue, Context))
+			{
+				return true;
+			}
+		}
+		
+		if (Context.Int64Strategy == EProtobufInt64Strategy::ErrorOnPrecisionLoss)
+		{
+			if (Val > static_cast<double>(ProtoBridgeConstants::MaxSafeInteger) || 
+				Val < static_cast<double>(ProtoBridgeConstants::MinSafeInteger))
+			{
+				UE_LOG(LogProtoBridgeCore, Error, TEXT("Numeric value %f exceeds safe integer precision for JSON."), Val);
+				return false;
+			}
+		}
+
+		OutValue.set_number_value(Val);
+		return true;
+	}
+
+	bool ResolveJsonNumber(double Val, bool& bOutIsInteger, bool& bOutAsString, const FProtoSerializationContext& Context)
+	{
+		bOutIsInteger = false;
+		bOutAsString = false;
+
+		if (!std::isfinite(Val) || FMath::Floor(Val) != Val)
+		{
+			return true;
+		}
+
+		if (Val >= static_cast<double>(ProtoBridgeConstants::MinSafeInteger) && 
+			Val <= static_cast<double>(ProtoBridgeConstants::MaxSafeInteger))
+		{
+			bOutIsInteger = true;
+			return true;
+		}
+
+		switch (Context.Int64Strategy)
+		{
+		case EProtobufInt64Strategy::AlwaysString:
+			bOutAsString = Val >= static_cast<double>(MIN_int64) && Val < -static_cast<double>(MIN_int64);
+			return true;
+
+		case EProtobufInt64Strategy::ErrorOnPrecisionLoss:
+			UE_LOG(LogProtoBridgeCore, Error, TEXT("Numeric value %f exceeds safe integer precision for JSON."), Val);
+			return false;
+
+		case EProtobufInt64Strategy::AlwaysNumber:
+		default:
+			if (!Context.bHasWarnedPrecisionLoss)
+			{
+				Context.bHasWarnedPrecisionLoss = true;
+				UE_LOG(LogProtoBridgeCore, Warning, TEXT("Numeric value %f exceeds safe double precision. Precision loss will occur. This warning is shown once per context."), Val);
+			}
+			return true;
+		}
+	}
+
+	EConversionStep BeginProtoStructToJson(const google::protobuf::Struct& InStruct, int32 Depth, TConversionStack<FProtoToJsonFrame>& Stack, TSharedPtr<FJsonValue>& OutJson, const FProtoSerializationContext& Context)
+	{
+		if (Depth >= Context.MaxJsonRecursionDepth)
+		{
+			UE_LOG(LogProtoBridgeCore, Error, TEXT("Recursion depth exceeded in ProtoStructToJsonObjectInternal"));
+			OutJson = nullptr;
+			return EConversionStep::Failed;
+		}
+
+		Stack.Emplace_GetRef(InStruct, Depth + 1).Object = MakeShared<FJsonObject>();
+		return EConversionStep::Descended;
+	}
+
+	EConversionStep BeginProtoValueToJson(const google::protobuf::Value& InValue, int32 Depth, TConversionStack<FProtoToJsonFrame>& Stack, TSharedPtr<FJsonValue>& OutJson, const FProtoSerializationContext& Context)
+	{
+		if (Depth >= Context.MaxJsonRecursionDepth)
+		{
+			OutJson = nullptr;
+			return EConversionStep::Failed;
+		}
+
+		switch (InValue.kind_case())
+		{
+		case google::protobuf::Value::kNumberValue:
+			OutJson = MakeShared<FJsonValueNumber>(InValue.number_value());
+			return EConversionStep::Succeeded;
+
+		case google::protobuf::Value::kStringValue:
+			OutJson = MakeShared<FJsonValueString>(FProtobufStringUtils::StdStringToFString(InValue.string_value()));
+			return EConversionStep::Succeeded;
+
+		case google::protobuf::Value::kBoolValue:
+			OutJson = MakeShared<FJsonValueBoolean>(InValue.bool_value());
+			return EConversionStep::Succeeded;
+
+		case google::protobuf::Value::kStructValue:
+			return BeginProtoStructToJson(InValue.struct_value(), Depth + 1, Stack, OutJson, Context);
+
+		case google::protobuf::Value::kListValue:
+			Stack.Emplace_GetRef(InValue.list_value(), Depth + 1).Items.Reserve(InValue.list_value().values_size());
+			return EConversionStep::Descended;
+
+		case google::protobuf::Value::kNullValue:
+		default:
+			OutJson = MakeShared<FJsonValueNull>();
+			return EConversionStep::Succeeded;
+		}
+	}
+
+	TSharedPtr<FJsonValue> RunProtoToJson(EConversionStep Step, TSharedPtr<FJsonValue> Result, TConversionStack<FProtoToJsonFrame>& Stack, const FProtoSerializationContext& Context)
+	{
+		while (Stack.Num() > 0)
+		{
+			FProtoToJsonFrame& Frame = Stack.Last();
+			if (Step != EConversionStep::Descended)
+			{
+				if (Frame.Cursor.Struct)
+				{
+					if (Result.IsValid())
+					{
+						Frame.Object->SetField(Frame.Key, MoveTemp(Result));
+					}
+				}
+				else if (Result.IsValid())
+				{
+					Frame.Items.Add(MoveTemp(Result));
+				}
+				else
+				{
+					Stack.Pop();
+					Step = EConversionStep::Failed;
+					continue;
+				}
+			}
+
+			const std::string* Key = nullptr;
+			if (const google::protobuf::Value* Child = Frame.Cursor.Next(Key))
+			{
+				if (Key)
+				{
+					FProtobufStringUtils::StdStringToFString(*Key, Frame.Key);
+				}
+				Step = BeginProtoValueToJson(*Child, Frame.Cursor.Depth, Stack, Result, Context);
+				continue;
+			}
+
+			if (Frame.Cursor.Struct)
+			{
+				Result = MakeShared<FJsonValueObject>(MoveTemp(Frame.Object));
+			}
+			else
+			{
+				Result = MakeShared<FJsonValueArray>(MoveTemp(Frame.Items));
+			}
+			Stack.Pop();
+			Step = EConversionStep::Succeeded;
+		}
+		return Result;
+	}
+
+	EConversionStep BeginJsonObjectToProto(const TSharedPtr<FJsonObject>& InJson, google::protobuf::Struct& OutStruct, int32 Depth, TConversionStack<FJsonToProtoFrame>& Stack, const FProtoSerializationContext& Context)
+	{
+		if (Depth >= Context.MaxJsonRecursionDepth)
+		{
+			UE_LOG(LogProtoBridgeCore, Error, TEXT("Recursion depth exceeded in JsonObjectToProtoStructInternal"));
+			return EConversionStep::Failed;
+		}
+
+		if (!InJson.IsValid()) return EConversionStep::Failed;
+
+		FJsonToProtoFrame& Frame = Stack.AddDefaulted_GetRef();
+		Frame.Struct = &OutStruct;
+		Frame.FieldIt.Emplace(InJson->Values.CreateConstIterator());
+		Frame.Depth = Depth + 1;
+		return EConversionStep::Descended;
+	}
+
+	EConversionStep BeginJsonValueToProto(const TSharedPtr<FJsonValue>& InJson, google::protobuf::Value& OutValue, int32 Depth, TConversionStack<FJsonToProtoFrame>& Stack, const FProtoSerializationContext& Context)
+	{
+		if (Depth >= Context.MaxJsonRecursionDepth)
+		{
+			return EConversionStep::Failed;
+		}
+
+		if (!InJson.IsValid())
+		{
+			OutValue.set_null_value(google::protobuf::NULL_VALUE);
+			return EConversionStep::Succeeded;
+		}
+
+		switch (InJson->Type)
+		{
+		case EJson::None:
+		case EJson::Null:
+			OutValue.set_null_value(google::protobuf::NULL_VALUE);
+			break;
+
+		case EJson::String:
+			FProtobufStringUtils::FStringToStdString(InJson->AsString(), *OutValue.mutable_string_value());
+			break;
+
+		case EJson::Number:
+			return JsonNumberToProtoValue(InJson->AsNumber(), OutValue, Context) ? EConversionStep::Succeeded : EConversionStep::Failed;
+
+		case EJson::Boolean:
+			OutValue.set_bool_value(InJson->AsBool());
+			break;
+
+		case EJson::Array:
+		{
+			FJsonToProtoFrame& Frame = Stack.AddDefaulted_GetRef();
+			Frame.List = OutValue.mutable_list_value();
+			Frame.Items = &InJson->AsArray();
+			Frame.Depth = Depth + 1;
+			return EConversionStep::Descended;
+		}
+
+		case EJson::Object:
+			return BeginJsonObjectToProto(InJson->AsObject(), *OutValue.mutable_struct_value(), Depth + 1, Stack, Context);
+		}
+
+		return EConversionStep::Succeeded;
+	}
+
+	bool RunJsonToProto(EConversionStep Step, TConversionStack<FJsonToProtoFrame>& Stack, const FProtoSerializationContext& Context)
+	{
+		while (Stack.Num() > 0)
+		{
+			FJsonToProtoFrame& Frame = Stack.Last();
+			if (Step == EConversionStep::Failed)
+			{
+				if (Frame.List)
+				{
+					UE_LOG(LogProtoBridgeCore, Error, TEXT("Failed to convert JSON Array Item at index %d"), Frame.ItemIndex - 1);
+					Stack.Pop();
+					continue;
+				}
+
+				UE_LOG(LogProtoBridgeCore, Error, TEXT("Failed to convert JSON field '%s' to Proto Value"), **Frame.JsonKey);
+				if (!Context.bBestEffortJsonParsing)
+				{
+					Stack.Pop();
+					continue;
+				}
+				Frame.Struct->mutable_fields()->erase(Frame.Key);
+			}
+
+			if (Frame.Struct)
+			{
+				TMap<FString, TSharedPtr<FJsonValue>>::TConstIterator& It = Frame.FieldIt.GetValue();
+				if (It)
+				{
+					Frame.JsonKey = &It->Key;
+					FProtobufStringUtils::FStringToStdString(It->Key, Frame.Key);
+					const TSharedPtr<FJsonValue>& Child = It->Value;
+					++It;
+					Step = BeginJsonValueToProto(Child, (*Frame.Struct->mutable_fields())[Frame.Key], Frame.Depth, Stack, Context);
+					continue;
+				}
+			}
+			else if (Frame.ItemIndex < Frame.Items->Num())
+			{
+				const TSharedPtr<FJsonValue>& Child = (*Frame.Items)[Frame.ItemIndex++];
+				Step = BeginJsonValueToProto(Child, *Frame.List->add_values(), Frame.Depth, Stack, Context);
+				continue;
+			}
+
+			Stack.Pop();
+			Step = EConversionStep::Succeeded;
+		}
+		return Step != EConversionStep::Failed;
+	}
+
+	template <class CharType, class PrintPolicy>
+	EConversionStep BeginWriteProtoStruct(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::Struct& InStruct, int32 Depth, TConversionStack<FProtoCursor>& Stack, const FProtoSerializationContext& Context)
+	{
+		if (Depth >= Context.MaxJsonRecursionDepth)
+		{
+			UE_LOG(LogProtoBridgeCore, Error, TEXT("Recursion depth exceeded in WriteProtoStruct"));
+			return EConversionStep::Failed;
+		}
+
+		Writer.WriteObjectStart();
+		Stack.Emplace(InStruct, Depth + 1);
+		return EConversionStep::Descended;
+	}
+
+	template <class CharType, class PrintPolicy>
+	EConversionStep BeginWriteProtoList(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::ListValue& InList, int32 Depth, TConversionStack<FProtoCursor>& Stack)
+	{
+		Writer.WriteArrayStart();
+		Stack.Emplace(InList, Depth);
+		return EConversionStep::Descended;
+	}
+
+	template <class CharType, class PrintPolicy>
+	EConversionStep BeginWriteProtoValue(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::Value& InValue, int32 Depth, TConversionStack<FProtoCursor>& Stack, const FProtoSerializationContext& Context)
+	{
+		if (Depth >= Context.MaxJsonRecursionDepth)
+		{
+			return EConversionStep::Failed;
+		}
+
+		switch (InValue.kind_case())
+		{
+		case google::protobuf::Value::kNumberValue:
+		{
+			const double Val = InValue.number_value();
+			bool bIsInteger = false;
+			bool bAsString = false;
+			if (!ResolveJsonNumber(Val, bIsInteger, bAsString, Context))
+			{
+				return EConversionStep::Failed;
+			}
+
+			if (!std::isfinite(Val))
+			{
+				Writer.WriteNull();
+			}
+			else if (bAsString)
+			{
+				Writer.WriteValue(FString::Printf(TEXT("%lld"), static_cast<int64>(Val)));
+			}
+			else if (bIsInteger)
+			{
+				Writer.WriteValue(static_cast<int64>(Val));
+			}
+			else
+			{
+				Writer.WriteValue(Val);
+			}
+			return EConversionStep::Succeeded;
+		}
+
+		case google::protobuf::Value::kStringValue:
+		{
+			const std::string& Str = InValue.string_value();
+			const auto Converted = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Str.data()), static_cast<int32>(Str.size()));
+			Writer.WriteValue(FStringView(Converted.Get(), Converted.Length()));
+			return EConversionStep::Succeeded;
+		}
+
+		case google::protobuf::Value::kBoolValue:
+			Writer.WriteValue(InValue.bool_value());
+			return EConversionStep::Succeeded;
+
+		case google::protobuf::Value::kStructValue:
+			return BeginWriteProtoStruct(Writer, InValue.struct_value(), Depth + 1, Stack, Context);
+
+		case google::protobuf::Value::kListValue:
+			return BeginWriteProtoList(Writer, InValue.list_value(), Depth + 1, Stack);
+
+		case google::protobuf::Value::kNullValue:
+		default:
+			Writer.WriteNull();
+			return EConversionStep::Succeeded;
+		}
+	}
+
+	template <class CharType, class PrintPolicy>
+	bool RunWriteProto(TJsonWriter<CharType, PrintPolicy>& Writer, EConversionStep Step, TConversionStack<FProtoCursor>& Stack, const FProtoSerializationContext& Context)
+	{
+		while (Stack.Num() > 0)
+		{
+			if (Step == EConversionStep::Failed)
+			{
+				return false;
+			}
+
+			FProtoCursor& Cursor = Stack.Last();
+			const std::string* Key = nullptr;
+			if (const google::protobuf::Value* Child = Cursor.Next(Key))
+			{
+				if (Key)
+				{
+					const auto Converted = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Key->data()), static_cast<int32>(Key->size()));
+					Writer.WriteIdentifierPrefix(FStringView(Converted.Get(), Converted.Length()));
+				}
+				Step = BeginWriteProtoValue(Writer, *Child, Cursor.Depth, Stack, Context);
+				continue;
+			}
+
+			if (Cursor.Struct)
+			{
+				Writer.WriteObjectEnd();
+			}
+			else
+			{
+				Writer.WriteArrayEnd();
+			}
+			Stack.Pop();
+			Step = EConversionStep::Succeeded;
+		}
+		return Step != EConversionStep::Failed;
+	}
+}
+
 TSharedPtr<FJsonObject> FProtobufStructUtils::ProtoStructToJsonObject(const google::protobuf::Struct& InStruct, const FProtoSerializationContext& Context)
 {
 	return ProtoStructToJsonObjectInternal(InStruct, 0, Context);
@@ -27,6 +509,7 @@ bool FProtobufStructUtils::JsonValueToProtoValue(const TSharedPtr<FJsonValue>& I
 
 bool FProtobufStructUtils::JsonListToProto(const TArray<TSharedPtr<FJsonValue>>& InList, google::protobuf::ListValue& OutList, const FProtoSerializationContext& Context)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
 	google::protobuf::ListValue TempList;
 	for (const auto& Item : InList) {
 		if (!JsonValueToProtoValue(Item, *TempList.add_values(), Context))
@@ -40,6 +523,7 @@ bool FProtobufStructUtils::JsonListToProto(const TArray<TSharedPtr<FJsonValue>>&
 
 TArray<TSharedPtr<FJsonValue>> FProtobufStructUtils::ProtoToJsonList(const google::protobuf::ListValue& InList, const FProtoSerializationContext& Context)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
 	TArray<TSharedPtr<FJsonValue>> Result;
 	Result.Reserve(InList.values_size());
 	for (const auto& Item : InList.values()) {
@@ -51,61 +535,22 @@ TArray<TSharedPtr<FJsonValue>> FProtobufStructUtils::ProtoToJsonList(const googl
 
 TSharedPtr<FJsonObject> FProtobufStructUtils::ProtoStructToJsonObjectInternal(const google::protobuf::Struct& InStruct, int32 CurrentDepth, const FProtoSerializationContext& Context)
 {
-	const int32 MaxDepth = Context.MaxJsonRecursionDepth;
-	if (CurrentDepth >= MaxDepth)
-	{
-		UE_LOG(LogProtoBridgeCore, Error, TEXT("Recursion depth exceeded in ProtoStructToJsonObjectInternal"));
-		return nullptr;
-	}
-
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
-
-	for (const auto& Pair : InStruct.fields())
-	{
-		FString Key = FProtobufStringUtils::StdStringToFString(Pair.first);
-		
-		TSharedPtr<FJsonValue> Val = ProtoValueToJsonValueInternal(Pair.second, CurrentDepth + 1, Context);
-		if (Val.IsValid())
-		{
-			JsonObject->SetField(Key, Val);
-		}
-	}
-
-	return JsonObject;
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	TConversionStack<FProtoToJsonFrame> Stack;
+	TSharedPtr<FJsonValue> Result;
+	const EConversionStep Step = BeginProtoStructToJson(InStruct, CurrentDepth, Stack, Result, Context);
+	Result = RunProtoToJson(Step, MoveTemp(Result), Stack, Context);
+	return Result.IsValid() ? Result->AsObject() : nullptr;
 }
 
 bool FProtobufStructUtils::JsonObjectToProtoStructInternal(const TSharedPtr<FJsonObject>& InJson, google::protobuf::Struct& OutStruct, int32 CurrentDepth, const FProtoSerializationContext& Context)
 {
-	const int32 MaxDepth = Context.MaxJsonRecursionDepth;
-	if (CurrentDepth >= MaxDepth)
-	{
-		UE_LOG(LogProtoBridgeCore, Error, TEXT("Recursion depth exceeded in JsonObjectToProtoStructInternal"));
-		return false;
-	}
-
-	if (!InJson.IsValid()) return false;
-
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	TConversionStack<FJsonToProtoFrame> Stack;
 	google::protobuf::Struct TempStruct;
-	auto* Map = TempStruct.mutable_fields();
-	
-	for (const auto& Pair : InJson->Values)
+	if (!RunJsonToProto(BeginJsonObjectToProto(InJson, TempStruct, CurrentDepth, Stack, Context), Stack, Context))
 	{
-		std::string Key;
-		FProtobufStringUtils::FStringToStdString(Pair.Key, Key);
-		
-		google::protobuf::Value Val;
-		if (JsonValueToProtoValueInternal(Pair.Value, Val, CurrentDepth + 1, Context))
-		{
-			(*Map)[Key] = Val;
-		}
-		else
-		{
-			UE_LOG(LogProtoBridgeCore, Error, TEXT("Failed to convert JSON field '%s' to Proto Value"), *Pair.Key);
-			if (!Context.bBestEffortJsonParsing)
-			{
-				return false;
-			}
-		}
+		return false;
 	}
 
 	OutStruct.Swap(&TempStruct);
@@ -114,144 +559,222 @@ bool FProtobufStructUtils::JsonObjectToProtoStructInternal(const TSharedPtr<FJso
 
 TSharedPtr<FJsonValue> FProtobufStructUtils::ProtoValueToJsonValueInternal(const google::protobuf::Value& InValue, int32 CurrentDepth, const FProtoSerializationContext& Context)
 {
-	const int32 MaxDepth = Context.MaxJsonRecursionDepth;
-	if (CurrentDepth >= MaxDepth)
-	{
-		return nullptr;
-	}
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	TConversionStack<FProtoToJsonFrame> Stack;
+	TSharedPtr<FJsonValue> Result;
+	const EConversionStep Step = BeginProtoValueToJson(InValue, CurrentDepth, Stack, Result, Context);
+	return RunProtoToJson(Step, MoveTemp(Result), Stack, Context);
+}
 
-	switch (InValue.kind_case())
-	{
-	case google::protobuf::Value::kNullValue:
-		return MakeShared<FJsonValueNull>();
-	
-	case google::protobuf::Value::kNumberValue:
-		return MakeShared<FJsonValueNumber>(InValue.number_value());
-	
-	case google::protobuf::Value::kStringValue:
-		return MakeShared<FJsonValueString>(FProtobufStringUtils::StdStringToFString(InValue.string_value()));
-	
-	case google::protobuf::Value::kBoolValue:
-		return MakeShared<FJsonValueBoolean>(InValue.bool_value());
-	
-	case google::protobuf::Value::kStructValue:
-	{
-		TSharedPtr<FJsonObject> JsonObj = ProtoStructToJsonObjectInternal(InValue.struct_value(), CurrentDepth + 1, Context);
-		if (JsonObj.IsValid())
-		{
-			return MakeShared<FJsonValueObject>(JsonObj);
-		}
-		return nullptr;
-	}
-	
-	case google::protobuf::Value::kListValue:
+bool FProtobufStructUtils::JsonValueToProtoValueInternal(const TSharedPtr<FJsonValue>& InJson, google::protobuf::Value& OutValue, int32 CurrentDepth, const FProtoSerializationContext& Context)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	TConversionStack<FJsonToProtoFrame> Stack;
+	google::protobuf::Value TempValue;
+	if (!RunJsonToProto(BeginJsonValueToProto(InJson, TempValue, CurrentDepth, Stack, Context), Stack, Context))
 	{
-		TArray<TSharedPtr<FJsonValue>> Array;
-		const auto& List = InValue.list_value();
-		Array.Reserve(List.values_size());
-		for (const auto& Item : List.values())
-		{
-			TSharedPtr<FJsonValue> JsonItem = ProtoValueToJsonValueInternal(Item, CurrentDepth + 1, Context);
-			if (JsonItem.IsValid())
-			{
-				Array.Add(JsonItem);
-			}
-			else
-			{
-				return nullptr;
-			}
-		}
-		return MakeShared<FJsonValueArray>(Array);
-	}
-	
-	default:
-		return MakeShared<FJsonValueNull>();
+		return false;
 	}
+
+	OutValue.Swap(&TempValue);
+	return true;
 }
 
-bool FProtobufStructUtils::JsonValueToProtoValueInternal(const TSharedPtr<FJsonValue>& InJson, google::protobuf::Value& OutValue, int32 CurrentDepth, const FProtoSerializationContext& Context)
+bool FProtobufStructUtils::JsonStringToProtoStruct(FUtf8StringView InJson, google::protobuf::Struct& OutStruct, const FProtoSerializationContext& Context)
 {
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
 	const int32 MaxDepth = Context.MaxJsonRecursionDepth;
-	if (CurrentDepth >= MaxDepth)
+	if (MaxDepth <= 0)
 	{
+		UE_LOG(LogProtoBridgeCore, Error, TEXT("Recursion depth exceeded in JsonStringToProtoStruct"));
 		return false;
 	}
 
-	if (!InJson.IsValid())
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(InJson);
+	EJsonNotation Notation = EJsonNotation::Error;
+	if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
 	{
-		OutValue.set_null_value(google::protobuf::NULL_VALUE);
-		return true;
+		UE_LOG(LogProtoBridgeCore, Error, TEXT("JSON document root must be an object"));
+		return false;
 	}
 
-	switch (InJson->Type)
-	{
-	case EJson::None:
-	case EJson::Null:
-		OutValue.set_null_value(google::protobuf::NULL_VALUE);
-		break;
-
-	case EJson::String:
-		FProtobufStringUtils::FStringToStdString(InJson->AsString(), *OutValue.mutable_string_value());
-		break;
+	google::protobuf::Struct TempStruct;
+	TConversionStack<FJsonParseFrame> Stack;
+	Stack.AddDefaulted_GetRef().Struct = &TempStruct;
+	int32 SkipDepth = 0;
 
-	case EJson::Number:
+	while (Stack.Num() > 0)
 	{
-		const double Val = InJson->AsNumber();
-		
-		if (Val >= static_cast<double>(ProtoBridgeConstants::MinSafeInteger) && 
-			Val <= static_cast<double>(ProtoBridgeConstants::MaxSafeInteger) &&
-			FMath::Floor(Val) == Val)
+		if (!Reader->ReadNext(Notation) || Notation == EJsonNotation::Error)
 		{
-			const int64 IntVal = static_cast<int64>(Val);
-			if (FProtobufReflectionUtils::ConvertInt64ToProtoValue(IntVal, OutValue, Context))
-			{
-				return true;
-			}
+			UE_LOG(LogProtoBridgeCore, Error, TEXT("Failed to parse JSON: %s"), *Reader->GetErrorMessage());
+			return false;
 		}
-		
-		if (Context.Int64Strategy == EProtobufInt64Strategy::ErrorOnPrecisionLoss)
+
+		const bool bOpensContainer = Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart;
+		const bool bClosesContainer = Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd;
+
+		if (SkipDepth > 0)
 		{
-			if (Val > static_cast<double>(ProtoBridgeConstants::MaxSafeInteger) || 
-				Val < static_cast<double>(ProtoBridgeConstants::MinSafeInteger))
-			{
-				UE_LOG(LogProtoBridgeCore, Error, TEXT("Numeric value %f exceeds safe integer precision for JSON."), Val);
-				return false;
-			}
+			SkipDepth += bOpensContainer ? 1 : (bClosesContainer ? -1 : 0);
+			continue;
 		}
 
-		OutValue.set_number_value(Val);
-		break;
-	}
+		if (bClosesContainer)
+		{
+			Stack.Pop();
+			continue;
+		}
 
-	case EJson::Boolean:
-		OutValue.set_bool_value(InJson->AsBool());
-		break;
+		FJsonParseFrame& Frame = Stack.Last();
+		google::protobuf::Value* Target = nullptr;
+		if (Frame.Struct)
+		{
+			FProtobufStringUtils::FStringToStdString(Reader->GetIdentifier(), Frame.Key);
+			Target = &(*Frame.Struct->mutable_fields())[Frame.Key];
+			Target->Clear();
+		}
+		else
+		{
+			Target = Frame.List->add_values();
+		}
 
-	case EJson::Array:
-	{
-		google::protobuf::ListValue TempList;
-		const TArray<TSharedPtr<FJsonValue>>& Array = InJson->AsArray();
-		int32 Index = 0;
-		for (const auto& Item : Array)
+		const int32 ValueDepth = Frame.Depth + 1;
+		bool bConverted = ValueDepth < MaxDepth;
+		if (bConverted)
 		{
-			if (!JsonValueToProtoValueInternal(Item, *TempList.add_values(), CurrentDepth + 1, Context))
+			switch (Notation)
 			{
-				UE_LOG(LogProtoBridgeCore, Error, TEXT("Failed to convert JSON Array Item at index %d"), Index);
-				return false;
+			case EJsonNotation::Null:
+				Target->set_null_value(google::protobuf::NULL_VALUE);
+				break;
+
+			case EJsonNotation::String:
+				FProtobufStringUtils::FStringToStdString(Reader->GetValueAsString(), *Target->mutable_string_value());
+				break;
+
+			case EJsonNotation::Boolean:
+				Target->set_bool_value(Reader->GetValueAsBoolean());
+				break;
+
+			case EJsonNotation::Number:
+				bConverted = JsonNumberToProtoValue(Reader->GetValueAsNumber(), *Target, Context);
+				break;
+
+			case EJsonNotation::ArrayStart:
+			{
+				FJsonParseFrame& Child = Stack.AddDefaulted_GetRef();
+				Child.List = Target->mutable_list_value();
+				Child.Depth = ValueDepth;
+				break;
+			}
+
+			case EJsonNotation::ObjectStart:
+				if (ValueDepth + 1 >= MaxDepth)
+				{
+					UE_LOG(LogProtoBridgeCore, Error, TEXT("Recursion depth exceeded in JsonStringToProtoStruct"));
+					bConverted = false;
+				}
+				else
+				{
+					FJsonParseFrame& Child = Stack.AddDefaulted_GetRef();
+					Child.Struct = Target->mutable_struct_value();
+					Child.Depth = ValueDepth + 1;
+				}
+				break;
+
+			default:
+				bConverted = false;
+				break;
 			}
-			Index++;
 		}
-		OutValue.mutable_list_value()->Swap(&TempList);
-		break;
-	}
 
-	case EJson::Object:
-		if (!JsonObjectToProtoStructInternal(InJson->AsObject(), *OutValue.mutable_struct_value(), CurrentDepth + 1, Context))
+		if (bConverted)
+		{
+			continue;
+		}
+
+		int32 OwnerIndex = Stack.Num() - 1;
+		while (Stack[OwnerIndex].Struct == nullptr)
+		{
+			--OwnerIndex;
+		}
+
+		FJsonParseFrame& Owner = Stack[OwnerIndex];
+		UE_LOG(LogProtoBridgeCore, Error, TEXT("Failed to convert JSON field '%s' to Proto Value"), UTF8_TO_TCHAR(Owner.Key.c_str()));
+		if (!Context.bBestEffortJsonParsing)
 		{
 			return false;
 		}
-		break;
+
+		SkipDepth = Stack.Num() - 1 - OwnerIndex + (bOpensContainer ? 1 : 0);
+		Owner.Struct->mutable_fields()->erase(Owner.Key);
+		Stack.SetNum(OwnerIndex + 1);
 	}
 
+	OutStruct.Swap(&TempStruct);
+	return true;
+}
+
+bool FProtobufStructUtils::ProtoStructToJsonString(const google::protobuf::Struct& InStruct, FString& OutJson, const FProtoSerializationContext& Context)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	FString TempJson;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&TempJson);
+	if (!WriteProtoStruct(*Writer, InStruct, Context) || !Writer->Close())
+	{
+		return false;
+	}
+	OutJson = MoveTemp(TempJson);
 	return true;
-}
\ No newline at end of file
+}
+
+bool FProtobufStructUtils::ProtoStructToJsonString(const google::protobuf::Struct& InStruct, TArray<uint8>& OutUtf8, const FProtoSerializationContext& Context)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	TArray<uint8> TempBytes;
+	FMemoryWriter Ar(TempBytes);
+	TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer = TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Ar);
+	if (!WriteProtoStruct(*Writer, InStruct, Context) || !Writer->Close())
+	{
+		return false;
+	}
+	OutUtf8 = MoveTemp(TempBytes);
+	return true;
+}
+
+template <class CharType, class PrintPolicy>
+bool FProtobufStructUtils::WriteProtoStruct(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::Struct& InStruct, const FProtoSerializationContext& Context)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	TConversionStack<FProtoCursor> Stack;
+	return RunWriteProto(Writer, BeginWriteProtoStruct(Writer, InStruct, 0, Stack, Context), Stack, Context);
+}
+
+template <class CharType, class PrintPolicy>
+bool FProtobufStructUtils::WriteProtoValue(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::Value& InValue, const FProtoSerializationContext& Context)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	TConversionStack<FProtoCursor> Stack;
+	return RunWriteProto(Writer, BeginWriteProtoValue(Writer, InValue, 0, Stack, Context), Stack, Context);
+}
+
+template <class CharType, class PrintPolicy>
+bool FProtobufStructUtils::WriteProtoList(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::ListValue& InList, const FProtoSerializationContext& Context)
+{
+	LLM_SCOPE_BYTAG(ProtoBridge_Json);
+	TConversionStack<FProtoCursor> Stack;
+	return RunWriteProto(Writer, BeginWriteProtoList(Writer, InList, 0, Stack), Stack, Context);
+}
+
+#define PROTOBRIDGE_INSTANTIATE_JSON_WRITER(CharType, PrintPolicy) \
+	template bool FProtobufStructUtils::WriteProtoStruct<CharType, PrintPolicy<CharType>>(TJsonWriter<CharType, PrintPolicy<CharType>>&, const google::protobuf::Struct&, const FProtoSerializationContext&); \
+	template bool FProtobufStructUtils::WriteProtoValue<CharType, PrintPolicy<CharType>>(TJsonWriter<CharType, PrintPolicy<CharType>>&, const google::protobuf::Value&, const FProtoSerializationContext&); \
+	template bool FProtobufStructUtils::WriteProtoList<CharType, PrintPolicy<CharType>>(TJsonWriter<CharType, PrintPolicy<CharType>>&, const google::protobuf::ListValue&, const FProtoSerializationContext&);
+
+PROTOBRIDGE_INSTANTIATE_JSON_WRITER(TCHAR, TCondensedJsonPrintPolicy)
+PROTOBRIDGE_INSTANTIATE_JSON_WRITER(TCHAR, TPrettyJsonPrintPolicy)
+PROTOBRIDGE_INSTANTIATE_JSON_WRITER(UTF8CHAR, TCondensedJsonPrintPolicy)
+PROTOBRIDGE_INSTANTIATE_JSON_WRITER(UTF8CHAR, TPrettyJsonPrintPolicy)
+
+#undef PROTOBRIDGE_INSTANTIATE_JSON_WRITER
\ No newline at end of file
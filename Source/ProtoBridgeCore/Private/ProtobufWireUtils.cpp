@@ -0,0 +1,673 @@
+﻿#include "ProtobufWireUtils.h"
+#include "ProtobufStringUtils.h"
+#include "ProtobufMathUtils.h"
+#include "Containers/StringConv.h"
+
+namespace
+{
+	using FOutputStream = ProtoWire::FOutputStream;
+	using FInputStream = ProtoWire::FInputStream;
+
+	size_t DoubleFieldSize(int32 FieldNumber, double Value)
+	{
+		return FProtobufWireUtils::ScalarFieldSizeIfSet<EProtoWireType::Double>(FieldNumber, Value);
+	}
+
+	void WriteDoubleField(int32 FieldNumber, double Value, FOutputStream& Stream)
+	{
+		FProtobufWireUtils::WriteScalarFieldIfSet<EProtoWireType::Double>(FieldNumber, Value, Stream);
+	}
+
+	size_t FloatFieldSize(int32 FieldNumber, float Value)
+	{
+		return FProtobufWireUtils::ScalarFieldSizeIfSet<EProtoWireType::Float>(FieldNumber, Value);
+	}
+
+	void WriteFloatField(int32 FieldNumber, float Value, FOutputStream& Stream)
+	{
+		FProtobufWireUtils::WriteScalarFieldIfSet<EProtoWireType::Float>(FieldNumber, Value, Stream);
+	}
+
+	size_t UInt32FieldSize(int32 FieldNumber, uint32 Value)
+	{
+		return FProtobufWireUtils::ScalarFieldSizeIfSet<EProtoWireType::UInt32>(FieldNumber, Value);
+	}
+
+	void WriteUInt32Field(int32 FieldNumber, uint32 Value, FOutputStream& Stream)
+	{
+		FProtobufWireUtils::WriteScalarFieldIfSet<EProtoWireType::UInt32>(FieldNumber, Value, Stream);
+	}
+
+	static_assert(PLATFORM_LITTLE_ENDIAN, "Packed math arrays are copied as raw little-endian doubles.");
+
+	template <typename T_Element>
+	constexpr int32 DoubleComponents = sizeof(T_Element) / sizeof(double);
+
+	size_t PackedDoublesSize(int32 FieldNumber, int32 NumDoubles)
+	{
+		if (NumDoubles == 0) return 0;
+		return FProtobufWireUtils::LengthDelimitedSize(FieldNumber, static_cast<size_t>(NumDoubles) * sizeof(double));
+	}
+
+	void WritePackedDoublesHeader(int32 FieldNumber, int32 NumDoubles, FOutputStream& Stream)
+	{
+		FProtobufWireUtils::WriteTag(FieldNumber, FProtobufWireUtils::FWireFormat::WIRETYPE_LENGTH_DELIMITED, Stream);
+		Stream.WriteVarint64(static_cast<uint64>(NumDoubles) * sizeof(double));
+	}
+
+	template <typename T_Element>
+	size_t PackedArraySize(const TArray<T_Element>& In)
+	{
+		static_assert(sizeof(T_Element) == DoubleComponents<T_Element> * sizeof(double), "Element must be a tightly packed run of doubles.");
+		return PackedDoublesSize(1, In.Num() * DoubleComponents<T_Element>);
+	}
+
+	template <typename T_Element>
+	void WritePackedArray(const TArray<T_Element>& In, FOutputStream& Stream)
+	{
+		if (In.Num() == 0) return;
+		WritePackedDoublesHeader(1, In.Num() * DoubleComponents<T_Element>, Stream);
+		Stream.WriteRaw(In.GetData(), In.Num() * static_cast<int32>(sizeof(T_Element)));
+	}
+
+	template <typename FFieldReader>
+	bool ReadFields(FInputStream& Stream, FFieldReader FieldReader)
+	{
+		uint32 Tag;
+		while ((Tag = Stream.ReadTag()) != 0)
+		{
+			if (!FieldReader(FProtobufWireUtils::GetTagFieldNumber(Tag), Tag))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+size_t FProtobufWireUtils::StringFieldSize(int32 FieldNumber, FStringView Value, FProtoDirectSizeCache& SizeCache)
+{
+	const int32 Utf8Len = FProtobufStringUtils::Utf8Length(Value);
+	SizeCache.SetSize(SizeCache.ReserveSize(), Utf8Len);
+	return LengthDelimitedSize(FieldNumber, Utf8Len);
+}
+
+void FProtobufWireUtils::WriteStringField(int32 FieldNumber, FStringView Value, FProtoDirectSizeCache& SizeCache, FOutputStream& Stream)
+{
+	const int32 Utf8Len = static_cast<int32>(SizeCache.ConsumeSize());
+	WriteTag(FieldNumber, FWireFormat::WIRETYPE_LENGTH_DELIMITED, Stream);
+	Stream.WriteVarint32(static_cast<uint32>(Utf8Len));
+	if (Utf8Len <= 0)
+	{
+		return;
+	}
+
+	if (uint8* Target = Stream.GetDirectBufferForNBytesAndAdvance(Utf8Len))
+	{
+		FProtobufStringUtils::FStringToUtf8(Value, reinterpret_cast<ANSICHAR*>(Target));
+		return;
+	}
+
+	TArray<ANSICHAR, TInlineAllocator<256>> Buffer;
+	Buffer.SetNumUninitialized(Utf8Len);
+	FProtobufStringUtils::FStringToUtf8(Value, Buffer.GetData());
+	Stream.WriteRaw(Buffer.GetData(), Utf8Len);
+}
+
+size_t FProtobufWireUtils::BytesFieldSize(int32 FieldNumber, const TArray<uint8>& Value)
+{
+	return LengthDelimitedSize(FieldNumber, Value.Num());
+}
+
+void FProtobufWireUtils::WriteBytesField(int32 FieldNumber, const TArray<uint8>& Value, FOutputStream& Stream)
+{
+	WriteTag(FieldNumber, FWireFormat::WIRETYPE_LENGTH_DELIMITED, Stream);
+	Stream.WriteVarint32(static_cast<uint32>(Value.Num()));
+	Stream.WriteRaw(Value.GetData(), Value.Num());
+}
+
+void FProtobufWireUtils::WriteMessageHeader(int32 FieldNumber, size_t MessageSize, FOutputStream& Stream)
+{
+	WriteTag(FieldNumber, FWireFormat::WIRETYPE_LENGTH_DELIMITED, Stream);
+	Stream.WriteVarint64(MessageSize);
+}
+
+void FProtobufWireUtils::WriteMessageField(int32 FieldNumber, const google::protobuf::MessageLite& Message, FOutputStream& Stream)
+{
+	WriteMessageHeader(FieldNumber, Message.ByteSizeLong(), Stream);
+	Message.SerializeWithCachedSizes(&Stream);
+}
+
+void FProtobufWireUtils::WriteConvertedMessageField(int32 FieldNumber, FProtoDirectSizeCache& SizeCache, FOutputStream& Stream)
+{
+	const google::protobuf::MessageLite& Message = SizeCache.ConsumeMessage();
+	WriteMessageHeader(FieldNumber, static_cast<size_t>(Message.GetCachedSize()), Stream);
+	Message.SerializeWithCachedSizes(&Stream);
+}
+
+size_t FProtobufWireUtils::FVectorSize(const FVector& In)
+{
+	return DoubleFieldSize(1, In.X) + DoubleFieldSize(2, In.Y) + DoubleFieldSize(3, In.Z);
+}
+
+void FProtobufWireUtils::WriteFVector(const FVector& In, FOutputStream& Stream)
+{
+	WriteDoubleField(1, In.X, Stream);
+	WriteDoubleField(2, In.Y, Stream);
+	WriteDoubleField(3, In.Z, Stream);
+}
+
+size_t FProtobufWireUtils::FVector3fSize(const FVector3f& In)
+{
+	return FloatFieldSize(1, In.X) + FloatFieldSize(2, In.Y) + FloatFieldSize(3, In.Z);
+}
+
+void FProtobufWireUtils::WriteFVector3f(const FVector3f& In, FOutputStream& Stream)
+{
+	WriteFloatField(1, In.X, Stream);
+	WriteFloatField(2, In.Y, Stream);
+	WriteFloatField(3, In.Z, Stream);
+}
+
+size_t FProtobufWireUtils::FVectorQuantizedSize(const FVector& In)
+{
+	const int32 Scale = FProtobufMathUtils::GetQuantizedVectorScale();
+	return ScalarFieldSizeIfSet<EProtoWireType::SInt32>(1, FProtobufMathUtils::QuantizeComponent(In.X, Scale))
+		+ ScalarFieldSizeIfSet<EProtoWireType::SInt32>(2, FProtobufMathUtils::QuantizeComponent(In.Y, Scale))
+		+ ScalarFieldSizeIfSet<EProtoWireType::SInt32>(3, FProtobufMathUtils::QuantizeComponent(In.Z, Scale))
+		+ UInt32FieldSize(4, Scale == FProtobufMathUtils::DefaultQuantizedVectorScale ? 0 : Scale);
+}
+
+void FProtobufWireUtils::WriteFVectorQuantized(const FVector& In, FOutputStream& Stream)
+{
+	const int32 Scale = FProtobufMathUtils::GetQuantizedVectorScale();
+	WriteScalarFieldIfSet<EProtoWireType::SInt32>(1, FProtobufMathUtils::QuantizeComponent(In.X, Scale), Stream);
+	WriteScalarFieldIfSet<EProtoWireType::SInt32>(2, FProtobufMathUtils::QuantizeComponent(In.Y, Scale), Stream);
+	WriteScalarFieldIfSet<EProtoWireType::SInt32>(3, FProtobufMathUtils::QuantizeComponent(In.Z, Scale), Stream);
+	WriteUInt32Field(4, Scale == FProtobufMathUtils::DefaultQuantizedVectorScale ? 0 : Scale, Stream);
+}
+
+size_t FProtobufWireUtils::FVector2DSize(const FVector2D& In)
+{
+	return DoubleFieldSize(1, In.X) + DoubleFieldSize(2, In.Y);
+}
+
+void FProtobufWireUtils::WriteFVector2D(const FVector2D& In, FOutputStream& Stream)
+{
+	WriteDoubleField(1, In.X, Stream);
+	WriteDoubleField(2, In.Y, Stream);
+}
+
+size_t FProtobufWireUtils::FQuatSize(const FQuat& In)
+{
+	return DoubleFieldSize(1, In.X) + DoubleFieldSize(2, In.Y) + DoubleFieldSize(3, In.Z) + DoubleFieldSize(4, In.W);
+}
+
+void FProtobufWireUtils::WriteFQuat(const FQuat& In, FOutputStream& Stream)
+{
+	WriteDoubleField(1, In.X, Stream);
+	WriteDoubleField(2, In.Y, Stream);
+	WriteDoubleField(3, In.Z, Stream);
+	WriteDoubleField(4, In.W, Stream);
+}
+
+size_t FProtobufWireUtils::FRotatorSize(const FRotator& In)
+{
+	return DoubleFieldSize(1, In.Pitch) + DoubleFieldSize(2, In.Yaw) + DoubleFieldSize(3, In.Roll);
+}
+
+void FProtobufWireUtils::WriteFRotator(const FRotator& In, FOutputStream& Stream)
+{
+	WriteDoubleField(1, In.Pitch, Stream);
+	WriteDoubleField(2, In.Yaw, Stream);
+	WriteDoubleField(3, In.Roll, Stream);
+}
+
+size_t FProtobufWireUtils::FQuatCompressedSize(const FQuat& In)
+{
+	return ScalarFieldSizeIfSet<EProtoWireType::Fixed64>(1, FProtobufMathUtils::CompressQuat(In));
+}
+
+void FProtobufWireUtils::WriteFQuatCompressed(const FQuat& In, FOutputStream& Stream)
+{
+	WriteScalarFieldIfSet<EProtoWireType::Fixed64>(1, FProtobufMathUtils::CompressQuat(In), Stream);
+}
+
+size_t FProtobufWireUtils::FRotator3fSize(const FRotator3f& In)
+{
+	return FloatFieldSize(1, In.Pitch) + FloatFieldSize(2, In.Yaw) + FloatFieldSize(3, In.Roll);
+}
+
+void FProtobufWireUtils::WriteFRotator3f(const FRotator3f& In, FOutputStream& Stream)
+{
+	WriteFloatField(1, In.Pitch, Stream);
+	WriteFloatField(2, In.Yaw, Stream);
+	WriteFloatField(3, In.Roll, Stream);
+}
+
+size_t FProtobufWireUtils::FRotatorQuantizedSize(const FRotator& In)
+{
+	return ScalarFieldSizeIfSet<EProtoWireType::UInt64>(1, FProtobufMathUtils::PackRotatorAngles(In));
+}
+
+void FProtobufWireUtils::WriteFRotatorQuantized(const FRotator& In, FOutputStream& Stream)
+{
+	WriteScalarFieldIfSet<EProtoWireType::UInt64>(1, FProtobufMathUtils::PackRotatorAngles(In), Stream);
+}
+
+size_t FProtobufWireUtils::FTransformSize(const FTransform& In)
+{
+	return MessageFieldSize(1, FVectorSize(In.GetLocation()))
+		+ MessageFieldSize(2, FQuatSize(In.GetRotation()))
+		+ MessageFieldSize(3, FVectorSize(In.GetScale3D()));
+}
+
+void FProtobufWireUtils::WriteFTransform(const FTransform& In, FOutputStream& Stream)
+{
+	const FVector Location = In.GetLocation();
+	const FQuat Rotation = In.GetRotation();
+	const FVector Scale = In.GetScale3D();
+
+	WriteMessageHeader(1, FVectorSize(Location), Stream);
+	WriteFVector(Location, Stream);
+	WriteMessageHeader(2, FQuatSize(Rotation), Stream);
+	WriteFQuat(Rotation, Stream);
+	WriteMessageHeader(3, FVectorSize(Scale), Stream);
+	WriteFVector(Scale, Stream);
+}
+
+size_t FProtobufWireUtils::FColorSize(const FColor& In)
+{
+	return UInt32FieldSize(1, In.R) + UInt32FieldSize(2, In.G) + UInt32FieldSize(3, In.B) + UInt32FieldSize(4, In.A);
+}
+
+void FProtobufWireUtils::WriteFColor(const FColor& In, FOutputStream& Stream)
+{
+	WriteUInt32Field(1, In.R, Stream);
+	WriteUInt32Field(2, In.G, Stream);
+	WriteUInt32Field(3, In.B, Stream);
+	WriteUInt32Field(4, In.A, Stream);
+}
+
+size_t FProtobufWireUtils::FLinearColorSize(const FLinearColor& In)
+{
+	return FloatFieldSize(1, In.R) + FloatFieldSize(2, In.G) + FloatFieldSize(3, In.B) + FloatFieldSize(4, In.A);
+}
+
+void FProtobufWireUtils::WriteFLinearColor(const FLinearColor& In, FOutputStream& Stream)
+{
+	WriteFloatField(1, In.R, Stream);
+	WriteFloatField(2, In.G, Stream);
+	WriteFloatField(3, In.B, Stream);
+	WriteFloatField(4, In.A, Stream);
+}
+
+size_t FProtobufWireUtils::FGuidSize(const FGuid& In)
+{
+	return UInt32FieldSize(1, In.A) + UInt32FieldSize(2, In.B) + UInt32FieldSize(3, In.C) + UInt32FieldSize(4, In.D);
+}
+
+void FProtobufWireUtils::WriteFGuid(const FGuid& In, FOutputStream& Stream)
+{
+	WriteUInt32Field(1, In.A, Stream);
+	WriteUInt32Field(2, In.B, Stream);
+	WriteUInt32Field(3, In.C, Stream);
+	WriteUInt32Field(4, In.D, Stream);
+}
+
+size_t FProtobufWireUtils::FVector2DArraySize(const TArray<FVector2D>& In)
+{
+	return PackedArraySize(In);
+}
+
+void FProtobufWireUtils::WriteFVector2DArray(const TArray<FVector2D>& In, FOutputStream& Stream)
+{
+	WritePackedArray(In, Stream);
+}
+
+size_t FProtobufWireUtils::FVectorArraySize(const TArray<FVector>& In)
+{
+	return PackedArraySize(In);
+}
+
+void FProtobufWireUtils::WriteFVectorArray(const TArray<FVector>& In, FOutputStream& Stream)
+{
+	WritePackedArray(In, Stream);
+}
+
+size_t FProtobufWireUtils::FQuatArraySize(const TArray<FQuat>& In)
+{
+	return PackedArraySize(In);
+}
+
+void FProtobufWireUtils::WriteFQuatArray(const TArray<FQuat>& In, FOutputStream& Stream)
+{
+	WritePackedArray(In, Stream);
+}
+
+size_t FProtobufWireUtils::FTransformArraySize(const TArray<FTransform>& In)
+{
+	return PackedDoublesSize(1, In.Num() * 3) + PackedDoublesSize(2, In.Num() * 4) + PackedDoublesSize(3, In.Num() * 3);
+}
+
+void FProtobufWireUtils::WriteFTransformArray(const TArray<FTransform>& In, FOutputStream& Stream)
+{
+	if (In.Num() == 0) return;
+
+	WritePackedDoublesHeader(1, In.Num() * 3, Stream);
+	for (const FTransform& Transform : In)
+	{
+		const FVector Location = Transform.GetLocation();
+		Stream.WriteRaw(&Location, sizeof(FVector));
+	}
+
+	WritePackedDoublesHeader(2, In.Num() * 4, Stream);
+	for (const FTransform& Transform : In)
+	{
+		const FQuat Rotation = Transform.GetRotation();
+		Stream.WriteRaw(&Rotation, sizeof(FQuat));
+	}
+
+	WritePackedDoublesHeader(3, In.Num() * 3, Stream);
+	for (const FTransform& Transform : In)
+	{
+		const FVector Scale = Transform.GetScale3D();
+		Stream.WriteRaw(&Scale, sizeof(FVector));
+	}
+}
+
+bool FProtobufWireUtils::ReadStringField(FInputStream& Stream, uint32 Tag, FString& Out)
+{
+	if (FWireFormat::GetTagWireType(Tag) != FWireFormat::WIRETYPE_LENGTH_DELIMITED) return SkipField(Stream, Tag);
+
+	int Length;
+	if (!ReadLength(Stream, Length)) return false;
+
+	const void* Direct = nullptr;
+	int Available = 0;
+	if (Length > 0 && Stream.GetDirectBufferPointer(&Direct, &Available) && Available >= Length)
+	{
+		FProtobufStringUtils::Utf8ToFString(static_cast<const ANSICHAR*>(Direct), Length, Out);
+		return Stream.Skip(Length);
+	}
+
+	TArray<ANSICHAR, TInlineAllocator<256>> Buffer;
+	Buffer.SetNumUninitialized(Length);
+	if (!Stream.ReadRaw(Buffer.GetData(), Length)) return false;
+
+	FProtobufStringUtils::Utf8ToFString(Buffer.GetData(), Length, Out);
+	return true;
+}
+
+bool FProtobufWireUtils::ReadBytesField(FInputStream& Stream, uint32 Tag, TArray<uint8>& Out)
+{
+	if (FWireFormat::GetTagWireType(Tag) != FWireFormat::WIRETYPE_LENGTH_DELIMITED) return SkipField(Stream, Tag);
+
+	int Length;
+	if (!ReadLength(Stream, Length)) return false;
+
+	Out.SetNumUninitialized(Length);
+	return Stream.ReadRaw(Out.GetData(), Length);
+}
+
+bool FProtobufWireUtils::ReadFVector(FInputStream& Stream, FVector& Out)
+{
+	Out = FVector::ZeroVector;
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.X);
+		case 2: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.Y);
+		case 3: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.Z);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+bool FProtobufWireUtils::ReadFVector3f(FInputStream& Stream, FVector3f& Out)
+{
+	Out = FVector3f::ZeroVector;
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.X);
+		case 2: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.Y);
+		case 3: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.Z);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+bool FProtobufWireUtils::ReadFVectorQuantized(FInputStream& Stream, FVector& Out)
+{
+	int32 X = 0;
+	int32 Y = 0;
+	int32 Z = 0;
+	uint32 Scale = 0;
+
+	const bool bSuccess = ReadFields(Stream, [&](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::SInt32>(Stream, Tag, X);
+		case 2: return ReadScalarField<EProtoWireType::SInt32>(Stream, Tag, Y);
+		case 3: return ReadScalarField<EProtoWireType::SInt32>(Stream, Tag, Z);
+		case 4: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Scale);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+
+	const int32 Divisor = static_cast<int32>(Scale);
+	Out = FVector(FProtobufMathUtils::DequantizeComponent(X, Divisor), FProtobufMathUtils::DequantizeComponent(Y, Divisor), FProtobufMathUtils::DequantizeComponent(Z, Divisor));
+	return bSuccess;
+}
+
+bool FProtobufWireUtils::ReadFVector2D(FInputStream& Stream, FVector2D& Out)
+{
+	Out = FVector2D::ZeroVector;
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.X);
+		case 2: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.Y);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+bool FProtobufWireUtils::ReadFQuat(FInputStream& Stream, FQuat& Out)
+{
+	Out = FQuat(0.0, 0.0, 0.0, 0.0);
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.X);
+		case 2: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.Y);
+		case 3: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.Z);
+		case 4: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.W);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+bool FProtobufWireUtils::ReadFRotator(FInputStream& Stream, FRotator& Out)
+{
+	Out = FRotator::ZeroRotator;
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.Pitch);
+		case 2: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.Yaw);
+		case 3: return ReadScalarField<EProtoWireType::Double>(Stream, Tag, Out.Roll);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+bool FProtobufWireUtils::ReadFQuatCompressed(FInputStream& Stream, FQuat& Out)
+{
+	uint64 Packed = 0;
+	const bool bSuccess = ReadFields(Stream, [&Stream, &Packed](int32 FieldNumber, uint32 Tag)
+	{
+		return FieldNumber == 1 ? ReadScalarField<EProtoWireType::Fixed64>(Stream, Tag, Packed) : SkipField(Stream, Tag);
+	});
+
+	Out = FProtobufMathUtils::DecompressQuat(Packed);
+	return bSuccess;
+}
+
+bool FProtobufWireUtils::ReadFRotator3f(FInputStream& Stream, FRotator3f& Out)
+{
+	Out = FRotator3f::ZeroRotator;
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.Pitch);
+		case 2: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.Yaw);
+		case 3: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.Roll);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+bool FProtobufWireUtils::ReadFRotatorQuantized(FInputStream& Stream, FRotator& Out)
+{
+	uint64 Packed = 0;
+	const bool bSuccess = ReadFields(Stream, [&Stream, &Packed](int32 FieldNumber, uint32 Tag)
+	{
+		return FieldNumber == 1 ? ReadScalarField<EProtoWireType::UInt64>(Stream, Tag, Packed) : SkipField(Stream, Tag);
+	});
+
+	Out = FProtobufMathUtils::UnpackRotatorAngles(Packed);
+	return bSuccess;
+}
+
+bool FProtobufWireUtils::ReadFTransform(FInputStream& Stream, FTransform& Out)
+{
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation(0.0, 0.0, 0.0, 0.0);
+	FVector Scale = FVector::ZeroVector;
+
+	const bool bSuccess = ReadFields(Stream, [&](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadMessageField(Stream, Tag, Location, &FProtobufWireUtils::ReadFVector);
+		case 2: return ReadMessageField(Stream, Tag, Rotation, &FProtobufWireUtils::ReadFQuat);
+		case 3: return ReadMessageField(Stream, Tag, Scale, &FProtobufWireUtils::ReadFVector);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+
+	Out = FTransform::Identity;
+	Out.SetLocation(Location);
+	Out.SetRotation(Rotation);
+	Out.SetScale3D(Scale);
+	return bSuccess;
+}
+
+bool FProtobufWireUtils::ReadFColor(FInputStream& Stream, FColor& Out)
+{
+	Out = FColor(0, 0, 0, 0);
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Out.R);
+		case 2: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Out.G);
+		case 3: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Out.B);
+		case 4: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Out.A);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+bool FProtobufWireUtils::ReadFLinearColor(FInputStream& Stream, FLinearColor& Out)
+{
+	Out = FLinearColor(0.f, 0.f, 0.f, 0.f);
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.R);
+		case 2: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.G);
+		case 3: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.B);
+		case 4: return ReadScalarField<EProtoWireType::Float>(Stream, Tag, Out.A);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+bool FProtobufWireUtils::ReadFGuid(FInputStream& Stream, FGuid& Out)
+{
+	Out = FGuid();
+	return ReadFields(Stream, [&Stream, &Out](int32 FieldNumber, uint32 Tag)
+	{
+		switch (FieldNumber)
+		{
+		case 1: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Out.A);
+		case 2: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Out.B);
+		case 3: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Out.C);
+		case 4: return ReadScalarField<EProtoWireType::UInt32>(Stream, Tag, Out.D);
+		default: return SkipField(Stream, Tag);
+		}
+	});
+}
+
+namespace
+{
+	template <typename T_Element>
+	bool ReadPackedArray(FInputStream& Stream, TArray<T_Element>& Out)
+	{
+		TArray<double> Components;
+		const bool bSuccess = ReadFields(Stream, [&Stream, &Components](int32 FieldNumber, uint32 Tag)
+		{
+			return FieldNumber == 1
+				? FProtobufWireUtils::ReadRepeatedScalarField<EProtoWireType::Double>(Stream, Tag, Components)
+				: FProtobufWireUtils::SkipField(Stream, Tag);
+		});
+
+		Out.SetNumUninitialized(Components.Num() / DoubleComponents<T_Element>);
+		FMemory::Memcpy(Out.GetData(), Components.GetData(), Out.Num() * sizeof(T_Element));
+		return bSuccess;
+	}
+}
+
+bool FProtobufWireUtils::ReadFVector2DArray(FInputStream& Stream, TArray<FVector2D>& Out)
+{
+	return ReadPackedArray(Stream, Out);
+}
+
+bool FProtobufWireUtils::ReadFVectorArray(FInputStream& Stream, TArray<FVector>& Out)
+{
+	return ReadPackedArray(Stream, Out);
+}
+
+bool FProtobufWireUtils::ReadFQuatArray(FInputStream& Stream, TArray<FQuat>& Out)
+{
+	return ReadPackedArray(Stream, Out);
+}
+
+bool FProtobufWireUtils::ReadFTransformArray(FInputStream& Stream, TArray<FTransform>& Out)
+{
+	TArray<double> Components[3];
+
+	const bool bSuccess = ReadFields(Stream, [&Stream, &Components](int32 FieldNumber, uint32 Tag)
+	{
+		return FieldNumber >= 1 && FieldNumber <= 3
+			? ReadRepeatedScalarField<EProtoWireType::Double>(Stream, Tag, Components[FieldNumber - 1])
+			: SkipField(Stream, Tag);
+	});
+
+	FProtobufMathUtils::PackedDoublesToFTransformArray(
+		Components[0].GetData(), Components[0].Num(), 
+		Components[1].GetData(), Components[1].Num(), 
+		Components[2].GetData(), Components[2].Num(), Out);
+	return bSuccess;
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+﻿#include "ProtobufMathUtils.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProtobufTransformArrayMalformedLengthsTest, "ProtoBridge.Core.Math.TransformArray.MalformedLengths",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FProtobufTransformArrayMalformedLengthsTest::RunTest(const FString& Parameters)
+{
+	// Four location doubles and two full rotations: the second transform has only a partial location and must not read past it.
+	const double Locations[] = { 1.0, 2.0, 3.0, 4.0 };
+	const double Rotations[] = { 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0 };
+	const double Scales[] = { 2.0, 2.0 };
+
+	TArray<FTransform> Transforms;
+	FProtobufMathUtils::PackedDoublesToFTransformArray(Locations, UE_ARRAY_COUNT(Locations), Rotations, UE_ARRAY_COUNT(Rotations), Scales, UE_ARRAY_COUNT(Scales), Transforms);
+
+	if (!TestEqual(TEXT("Transform count"), Transforms.Num(), 2))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("First location"), Transforms[0].GetLocation(), FVector(1.0, 2.0, 3.0));
+	TestEqual(TEXT("First scale falls back to one"), Transforms[0].GetScale3D(), FVector::OneVector);
+	TestEqual(TEXT("Partial location falls back to zero"), Transforms[1].GetLocation(), FVector::ZeroVector);
+	TestTrue(TEXT("Second rotation is read"), Transforms[1].GetRotation().Equals(FQuat(0.0, 0.0, 1.0, 0.0)));
+
+	TArray<FTransform> Empty;
+	FProtobufMathUtils::PackedDoublesToFTransformArray(Locations, 2, Rotations, 3, Scales, 1, Empty);
+	TestEqual(TEXT("Lengths below one component produce no transforms"), Empty.Num(), 0);
+
+	return true;
+}
+
+namespace
+{
+	/** Largest per-component difference between two quaternions, treating q and -q as the same rotation. */
+	double QuatComponentError(const FQuat& Expected, const FQuat& Actual)
+	{
+		const double Same = FMath::Max(FMath::Max(FMath::Abs(Expected.X - Actual.X), FMath::Abs(Expected.Y - Actual.Y)), FMath::Max(FMath::Abs(Expected.Z - Actual.Z), FMath::Abs(Expected.W - Actual.W)));
+		const double Flipped = FMath::Max(FMath::Max(FMath::Abs(Expected.X + Actual.X), FMath::Abs(Expected.Y + Actual.Y)), FMath::Max(FMath::Abs(Expected.Z + Actual.Z), FMath::Abs(Expected.W + Actual.W)));
+		return FMath::Min(Same, Flipped);
+	}
+
+	// Four components each off by at most the component bound move the quaternion by at most twice that, and the angle is twice the chord.
+	constexpr double CompressedQuatMaxAngularError = 4.0 * FProtobufMathUtils::CompressedQuatMaxComponentError;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProtobufCompressedQuatErrorBoundTest, "ProtoBridge.Core.Math.CompressedQuat.ErrorBound",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FProtobufCompressedQuatErrorBoundTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(0x5EED);
+	double MaxComponentError = 0.0;
+	double MaxAngularError = 0.0;
+	for (int32 Index = 0; Index < 100000; ++Index)
+	{
+		const FQuat Quat = FQuat(Random.FRandRange(-1.0, 1.0), Random.FRandRange(-1.0, 1.0), Random.FRandRange(-1.0, 1.0), Random.FRandRange(-1.0, 1.0)).GetNormalized();
+		const FQuat Decoded = FProtobufMathUtils::DecompressQuat(FProtobufMathUtils::CompressQuat(Quat));
+		MaxComponentError = FMath::Max(MaxComponentError, QuatComponentError(Quat, Decoded));
+		MaxAngularError = FMath::Max(MaxAngularError, Quat.AngularDistance(Decoded));
+	}
+
+	TestTrue(FString::Printf(TEXT("Max component error %.3g within %.3g"), MaxComponentError, FProtobufMathUtils::CompressedQuatMaxComponentError),
+		MaxComponentError <= FProtobufMathUtils::CompressedQuatMaxComponentError);
+	TestTrue(FString::Printf(TEXT("Max angular error %.3g rad within %.3g"), MaxAngularError, CompressedQuatMaxAngularError),
+		MaxAngularError <= CompressedQuatMaxAngularError);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProtobufCompressedQuatRoundTripTest, "ProtoBridge.Core.Math.CompressedQuat.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FProtobufCompressedQuatRoundTripTest::RunTest(const FString& Parameters)
+{
+	// One rotation per largest component, X through W, so every index the two top bits can hold is exercised.
+	const FQuat Cases[] = {
+		FQuat(0.9, 0.1, -0.3, 0.2).GetNormalized(),
+		FQuat(-0.2, 0.8, 0.4, -0.1).GetNormalized(),
+		FQuat(0.3, -0.1, -0.85, 0.25).GetNormalized(),
+		FQuat(0.1, 0.2, 0.3, 0.9).GetNormalized()
+	};
+
+	for (int32 LargestIndex = 0; LargestIndex < static_cast<int32>(UE_ARRAY_COUNT(Cases)); ++LargestIndex)
+	{
+		const FQuat& Quat = Cases[LargestIndex];
+		const uint64 Packed = FProtobufMathUtils::CompressQuat(Quat);
+		const FString Label = FString::Printf(TEXT("Largest component %d"), LargestIndex);
+
+		TestEqual(Label + TEXT(" index"), static_cast<int32>(Packed >> (3 * FProtobufMathUtils::CompressedQuatComponentBits)), LargestIndex);
+		TestTrue(Label + TEXT(" round trip"), QuatComponentError(Quat, FProtobufMathUtils::DecompressQuat(Packed)) <= FProtobufMathUtils::CompressedQuatMaxComponentError);
+
+		const FQuat Negated(-Quat.X, -Quat.Y, -Quat.Z, -Quat.W);
+		TestEqual(Label + TEXT(" packs q and -q identically"), FProtobufMathUtils::CompressQuat(Negated), Packed);
+		TestTrue(Label + TEXT(" -q round trip"), QuatComponentError(Negated, FProtobufMathUtils::DecompressQuat(FProtobufMathUtils::CompressQuat(Negated))) <= FProtobufMathUtils::CompressedQuatMaxComponentError);
+	}
+
+	TestTrue(TEXT("Identity round trip"), FProtobufMathUtils::DecompressQuat(FProtobufMathUtils::CompressQuat(FQuat::Identity)).Equals(FQuat::Identity, FProtobufMathUtils::CompressedQuatMaxComponentError));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProtobufCompressedQuatInvalidPackedTest, "ProtoBridge.Core.Math.CompressedQuat.InvalidPacked",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FProtobufCompressedQuatInvalidPackedTest::RunTest(const FString& Parameters)
+{
+	TestTrue(TEXT("Unset packed value decodes to identity"), FProtobufMathUtils::DecompressQuat(0).Equals(FQuat::Identity, 0.0));
+
+	// Bit patterns whose smallest three do not fit on the unit sphere, e.g. all three at the top of their range.
+	const uint64 Corrupt[] = { ~0ull, 1ull, 0x5555555555555555ull, 0xAAAAAAAAAAAAAAAAull };
+	for (const uint64 Packed : Corrupt)
+	{
+		TestTrue(FString::Printf(TEXT("0x%016llx decodes to a unit quaternion"), Packed), FProtobufMathUtils::DecompressQuat(Packed).IsNormalized());
+	}
+	return true;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,195 @@
+﻿#include "ProtobufStringUtils.h"
+#include "Containers/StringConv.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Lengths up to this cross both the 16-unit SSE2/NEON and the 32-unit AVX2 blocks twice. */
+	constexpr int32 MaxTestLength = 70;
+
+	FString MakeAscii(int32 Length)
+	{
+		FString Result;
+		Result.Reserve(Length);
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			Result.AppendChar(static_cast<TCHAR>(TEXT('a') + Index % 26));
+		}
+		return Result;
+	}
+
+	/**
+	 * Encodes Input through every FProtobufStringUtils entry point and compares the bytes with the engine
+	 * converter's output for Reference. Valid strings pass themselves as Reference and must also decode back.
+	 */
+	bool TestUtf8Encoding(FAutomationTestBase& Test, const FString& What, const FString& Input, const FString& Reference, bool bDecodes)
+	{
+		const FTCHARToUTF8 Expected(*Reference, Reference.Len());
+		const std::string Expected8(Expected.Get(), Expected.Length());
+
+		const std::string Encoded = FProtobufStringUtils::FStringToStdString(Input);
+		if (!Test.TestTrue(*FString::Printf(TEXT("%s: FStringToStdString matches FTCHARToUTF8"), *What), Encoded == Expected8))
+		{
+			return false;
+		}
+
+		if (!Test.TestEqual(*FString::Printf(TEXT("%s: Utf8Length"), *What), FProtobufStringUtils::Utf8Length(Input), Expected.Length()))
+		{
+			return false;
+		}
+
+		// Exactly-sized destination plus one guard byte that the encoder must not touch.
+		constexpr ANSICHAR Guard = 'Z';
+		TArray<ANSICHAR> Buffer;
+		Buffer.Init(0, Expected.Length() + 1);
+		Buffer[Expected.Length()] = Guard;
+		const int32 Written = FProtobufStringUtils::FStringToUtf8(Input, Buffer.GetData());
+		if (!Test.TestEqual(*FString::Printf(TEXT("%s: FStringToUtf8 length"), *What), Written, Expected.Length())
+			|| !Test.TestTrue(*FString::Printf(TEXT("%s: FStringToUtf8 bytes"), *What), FMemory::Memcmp(Buffer.GetData(), Expected.Get(), Written) == 0)
+			|| !Test.TestEqual(*FString::Printf(TEXT("%s: FStringToUtf8 stays in bounds"), *What), static_cast<int32>(Buffer[Expected.Length()]), static_cast<int32>(Guard)))
+		{
+			return false;
+		}
+
+		if (bDecodes)
+		{
+			const FString Decoded = FProtobufStringUtils::StdStringToFString(Encoded);
+			return Test.TestTrue(*FString::Printf(TEXT("%s: decodes back"), *What), Decoded.Equals(Input, ESearchCase::CaseSensitive));
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProtobufStringUtilsAsciiTest, "ProtoBridge.Core.Strings.Utf8.Ascii",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FProtobufStringUtilsAsciiTest::RunTest(const FString& Parameters)
+{
+	for (int32 Length = 0; Length <= MaxTestLength; ++Length)
+	{
+		const FString Input = MakeAscii(Length);
+		if (!TestUtf8Encoding(*this, FString::Printf(TEXT("Length %d"), Length), Input, Input, true))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProtobufStringUtilsMixedTest, "ProtoBridge.Core.Strings.Utf8.Mixed",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FProtobufStringUtilsMixedTest::RunTest(const FString& Parameters)
+{
+	// Two- and three-byte sequences dropped at every position, so the vector loop bails out on each lane of each block.
+	const TCHAR NonAscii[] = { static_cast<TCHAR>(0x00E9), static_cast<TCHAR>(0x07FF), static_cast<TCHAR>(0x0800), static_cast<TCHAR>(0x4E2D), static_cast<TCHAR>(0xFFFD) };
+	for (const TCHAR Char : NonAscii)
+	{
+		for (int32 Length = 1; Length <= MaxTestLength; ++Length)
+		{
+			for (int32 Position = 0; Position < Length; ++Position)
+			{
+				FString Input = MakeAscii(Length);
+				Input[Position] = Char;
+				if (!TestUtf8Encoding(*this, FString::Printf(TEXT("U+%04X at %d of %d"), static_cast<uint32>(Char), Position, Length), Input, Input, true))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	// Alternating runs whose lengths straddle the block sizes, so the encoder re-enters the vector loop mid-string.
+	const int32 RunLengths[] = { 1, 15, 16, 17, 31, 32, 33 };
+	for (const int32 AsciiRun : RunLengths)
+	{
+		for (const int32 WideRun : RunLengths)
+		{
+			FString Input;
+			for (int32 Repeat = 0; Repeat < 3; ++Repeat)
+			{
+				Input += MakeAscii(AsciiRun);
+				for (int32 Index = 0; Index < WideRun; ++Index)
+				{
+					Input.AppendChar(static_cast<TCHAR>(0x0400 + Index));
+				}
+			}
+			if (!TestUtf8Encoding(*this, FString::Printf(TEXT("Runs %d/%d"), AsciiRun, WideRun), Input, Input, true))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProtobufStringUtilsSurrogateTest, "ProtoBridge.Core.Strings.Utf8.Surrogates",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FProtobufStringUtilsSurrogateTest::RunTest(const FString& Parameters)
+{
+	const TCHAR High = static_cast<TCHAR>(0xD83D);
+	const TCHAR Low = static_cast<TCHAR>(0xDE00);
+
+	// A pair at every position, including straddling the 16- and 32-unit boundaries.
+	for (int32 Length = 2; Length <= MaxTestLength; ++Length)
+	{
+		for (int32 Position = 0; Position + 1 < Length; ++Position)
+		{
+			FString Input = MakeAscii(Length);
+			Input[Position] = High;
+			Input[Position + 1] = Low;
+			if (!TestUtf8Encoding(*this, FString::Printf(TEXT("Pair at %d of %d"), Position, Length), Input, Input, true))
+			{
+				return false;
+			}
+		}
+	}
+
+	// Unpaired surrogates are replaced by '?', so the reference is the sanitized string.
+	struct FUnpairedCase
+	{
+		const TCHAR* Name;
+		TArray<TCHAR> Input;
+		const TCHAR* Reference;
+	};
+	const FUnpairedCase Cases[] = {
+		{ TEXT("Lone high"), { High }, TEXT("?") },
+		{ TEXT("Lone low"), { Low }, TEXT("?") },
+		{ TEXT("High then ASCII"), { High, TEXT('a') }, TEXT("?a") },
+		{ TEXT("Low then high"), { Low, High }, TEXT("??") },
+		{ TEXT("High before pair"), { High, High, Low }, nullptr },
+		{ TEXT("Pair before low"), { High, Low, Low }, nullptr },
+	};
+	for (const FUnpairedCase& Case : Cases)
+	{
+		const FString Input(Case.Input.Num(), Case.Input.GetData());
+		FString Reference;
+		if (Case.Reference)
+		{
+			Reference = Case.Reference;
+		}
+		else
+		{
+			// The stray unit becomes '?', the valid pair is kept.
+			Reference = Input;
+			Reference[Case.Input[1] == High ? 0 : 2] = TEXT('?');
+		}
+		if (!TestUtf8Encoding(*this, Case.Name, Input, Reference, false))
+		{
+			return false;
+		}
+
+		// The same case with its stray unit on the far side of a vector block.
+		const FString Padded = MakeAscii(31) + Input + MakeAscii(33);
+		if (!TestUtf8Encoding(*this, FString::Printf(TEXT("%s (padded)"), Case.Name), Padded, MakeAscii(31) + Reference + MakeAscii(33), false))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif
\ No newline at end of file
@@ -10,7 +10,8 @@ public class ProtoBridgeCore : ModuleRules
 			"Core", 
 			"ProtoBridgeThirdParty", 
 			"GameplayTags", 
-			"Json" 
+			"Json",
+			"TraceLog"
 		});
 		
 		PrivateDependencyModuleNames.AddRange(new string[] { 
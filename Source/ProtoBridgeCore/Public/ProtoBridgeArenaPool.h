@@ -0,0 +1,45 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+namespace google {
+	namespace protobuf {
+		class Arena;
+	}
+}
+
+struct FProtoArenaStats
+{
+	uint64 Acquisitions = 0;
+	uint64 Resets = 0;
+	uint64 OverflowResets = 0;
+	uint64 PeakSpaceAllocated = 0;
+};
+
+class PROTOBRIDGECORE_API FProtoBridgeArenaPool
+{
+public:
+	static constexpr int32 InitialBlockSize = 64 * 1024;
+	static constexpr int32 MaxBlockSize = 1024 * 1024;
+
+	/** Returns the calling thread's arena. Every Acquire must be paired with a Release; the arena is reset when the outermost scope releases it. */
+	static google::protobuf::Arena* AcquireThreadArena();
+	static void ReleaseThreadArena();
+
+	static FProtoArenaStats GetThreadStats();
+};
+
+class PROTOBRIDGECORE_API FProtoArenaScope
+{
+public:
+	FProtoArenaScope();
+	~FProtoArenaScope();
+
+	FProtoArenaScope(const FProtoArenaScope&) = delete;
+	FProtoArenaScope& operator=(const FProtoArenaScope&) = delete;
+
+	google::protobuf::Arena* GetArena() const { return Arena; }
+
+private:
+	google::protobuf::Arena* Arena;
+};
\ No newline at end of file
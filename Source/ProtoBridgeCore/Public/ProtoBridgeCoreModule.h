@@ -8,4 +8,7 @@ class FProtoBridgeCoreModule : public IModuleInterface
 public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	FDelegateHandle TagTreeChangedHandle;
 };
\ No newline at end of file
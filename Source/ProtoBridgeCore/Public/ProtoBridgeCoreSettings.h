@@ -30,6 +30,10 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Limits", meta = (ClampMin = "1", ClampMax = "1000", DisplayName = "Max JSON Recursion Depth"))
 	int32 MaxJsonRecursionDepth;
 
+	/** Fixed-point steps per world unit used when encoding FVectorQuantizedProto. The scale travels with the message, so decoders need not agree. */
+	UPROPERTY(Config, EditAnywhere, Category = "Quantization", meta = (ClampMin = "1", ClampMax = "10000", DisplayName = "Quantized Vector Scale"))
+	int32 QuantizedVectorScale;
+
 	virtual FName GetContainerName() const override;
 	virtual FName GetCategoryName() const override;
 	virtual FName GetSectionName() const override;
@@ -5,5 +5,5 @@
 
 namespace ProtoBridge::EncoderRegistry
 {
-	void PROTOBRIDGECORE_API GetDefaultEncoders(TMap<EVariantTypes, FVariantEncoder>& OutEncoders);
+	void PROTOBRIDGECORE_API GetDefaultEncoders(FVariantEncoderTable& OutEncoders);
 }
\ No newline at end of file
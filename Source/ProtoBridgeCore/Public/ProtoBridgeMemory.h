@@ -0,0 +1,18 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/** LLM tags for ProtoBridge allocations. Only tallied when the tracker is running (-llm); they compile out entirely without ENABLE_LOW_LEVEL_MEM_TRACKER. */
+LLM_DECLARE_TAG_API(ProtoBridge, PROTOBRIDGECORE_API);
+LLM_DECLARE_TAG_API(ProtoBridge_Decode, PROTOBRIDGECORE_API);
+LLM_DECLARE_TAG_API(ProtoBridge_Encode, PROTOBRIDGECORE_API);
+LLM_DECLARE_TAG_API(ProtoBridge_Json, PROTOBRIDGECORE_API);
+LLM_DECLARE_TAG_API(ProtoBridge_Arena, PROTOBRIDGECORE_API);
+
+class PROTOBRIDGECORE_API FProtoBridgeMemory
+{
+public:
+	/** Logs the live bytes currently attributed to each ProtoBridge tag. */
+	static void ReportTags();
+};
\ No newline at end of file
@@ -0,0 +1,82 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("ProtoBridge"), STATGROUP_ProtoBridge, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(ProtoBridgeChannel, PROTOBRIDGECORE_API);
+
+enum class EProtoMetricOp : uint8
+{
+	ToProto,
+	FromProto,
+	Encode,
+	Decode,
+	Num
+};
+
+/** Counters for one generated type and operation. Sites are function-local statics in generated code and register themselves once. */
+class PROTOBRIDGECORE_API FProtoMetricSite
+{
+public:
+	/** Bucket N counts calls that took under 2^N microseconds; the last bucket is open-ended. */
+	static constexpr int32 NumHistogramBuckets = 16;
+
+	FProtoMetricSite(const TCHAR* InTypeName, EProtoMetricOp InOp);
+	~FProtoMetricSite();
+
+	FProtoMetricSite(const FProtoMetricSite&) = delete;
+	FProtoMetricSite& operator=(const FProtoMetricSite&) = delete;
+
+	void Record(uint64 InCycles, int64 InBytes);
+	void Reset();
+
+	const TCHAR* GetTypeName() const { return TypeName; }
+	EProtoMetricOp GetOp() const { return Op; }
+	uint32 GetTraceSpecId();
+
+	std::atomic<uint64> Calls { 0 };
+	std::atomic<uint64> Bytes { 0 };
+	std::atomic<uint64> Cycles { 0 };
+	std::atomic<uint64> Histogram[NumHistogramBuckets] = {};
+
+private:
+	const TCHAR* TypeName;
+	EProtoMetricOp Op;
+	std::atomic<uint32> TraceSpecId { 0 };
+};
+
+class PROTOBRIDGECORE_API FProtoMetricScope
+{
+public:
+	explicit FProtoMetricScope(FProtoMetricSite& InSite, int64 InBytes = 0);
+	/** Attributes the bytes Output gains (bAppends) or ends up holding by the time the scope closes. */
+	FProtoMetricScope(FProtoMetricSite& InSite, const TArray<uint8>& Output, bool bAppends);
+	~FProtoMetricScope();
+
+	FProtoMetricScope(const FProtoMetricScope&) = delete;
+	FProtoMetricScope& operator=(const FProtoMetricScope&) = delete;
+
+	void SetBytes(int64 InBytes) { Bytes = InBytes; }
+
+private:
+	FScopeCycleCounter StatScope;
+	FProtoMetricSite* Site;
+	const TArray<uint8>* Output;
+	int64 Bytes;
+	uint64 StartCycles;
+	bool bTraced;
+};
+
+class PROTOBRIDGECORE_API FProtoBridgeMetrics
+{
+public:
+	static bool IsEnabled();
+	static void ForEachSite(TFunctionRef<void(const FProtoMetricSite&)> Visitor);
+	static void ResetAll();
+	static bool DumpCsv(const FString& Path);
+	static const TCHAR* GetOpName(EProtoMetricOp Op);
+};
\ No newline at end of file
@@ -0,0 +1,30 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+struct FProtoNameCacheStats
+{
+	uint64 NameHits = 0;
+	uint64 NameMisses = 0;
+	uint64 TagHits = 0;
+	uint64 TagMisses = 0;
+};
+
+/** Sharded cache from UTF-8 bytes to resolved FName / FGameplayTag. Keys are hashed straight from the wire bytes, so hits skip transcoding and the global name table. */
+class PROTOBRIDGECORE_API FProtoBridgeNameCache
+{
+public:
+	static constexpr int32 NumShards = 16;
+	static constexpr int32 MaxEntriesPerShard = 4096;
+
+	static FName ResolveName(const ANSICHAR* InData, int32 InLen);
+	static FGameplayTag ResolveGameplayTag(const ANSICHAR* InData, int32 InLen);
+
+	/** Drops cached tags; called automatically when the gameplay tag tree is rebuilt. */
+	static void InvalidateGameplayTags();
+	static void Reset();
+
+	static FProtoNameCacheStats GetStats();
+	static void ResetStats();
+};
\ No newline at end of file
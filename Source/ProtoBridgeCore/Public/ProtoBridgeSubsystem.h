@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "ProtoBridgeTypes.h"
+#include <atomic>
 #include "ProtoBridgeSubsystem.generated.h"
 
 UCLASS()
@@ -14,17 +15,42 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
-	void RegisterVariantEncoder(EVariantTypes Type, FVariantEncoder Encoder);
-	void RegisterEncodersBatch(const TMap<EVariantTypes, FVariantEncoder>& InEncoders);
+	void RegisterVariantEncoder(EVariantTypes Type, FVariantEncoderFunc Encoder, void* UserData = nullptr);
+	void RegisterEncodersBatch(const FVariantEncoderTable& InEncoders);
 	
 	void SetInt64SerializationStrategy(EProtobufInt64Strategy InStrategy);
 	EProtobufInt64Strategy GetInt64SerializationStrategy() const;
 
 	FProtoSerializationContext CreateSerializationContext() const;
 
+	/**
+	 * Per-thread copy of the current snapshot that stays valid on the calling thread. Lock-free while the snapshot
+	 * is unchanged; the first call after settings or encoders change takes the publish lock to refresh it in place.
+	 */
+	const FProtoSerializationContext& GetSerializationContext() const;
+	uint32 GetContextRebuildCount() const;
+
 private:
-	mutable FRWLock StateLock;
+	void PublishEncoders(TFunctionRef<void(FVariantEncoderTable&)> Mutate);
+	void RebuildContextLocked();
+
+#if WITH_EDITOR
+	void HandleSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent);
+	FDelegateHandle SettingsChangedHandle;
+#endif
+
 	bool bIsInitialized;
+
+	/** Serializes writers and snapshot copies; readers only take it when ActiveVersion has moved past their cached copy. */
+	mutable FCriticalSection PublishLock;
 	EProtobufInt64Strategy Int64Strategy;
-	TSharedPtr<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe> VariantEncoders;
+	const FVariantEncoderTable* ActiveEncoders = nullptr;
+
+	/** Every table ever published, kept until destruction because cached context copies still point into them. */
+	TArray<TUniquePtr<FVariantEncoderTable>> PublishedEncoders;
+
+	/** The current snapshot. Rebuilds overwrite it in place, so retired snapshots cost nothing. */
+	FProtoSerializationContext ActiveContext;
+	std::atomic<uint32> ActiveVersion { 0 };
+	std::atomic<uint32> ContextRebuildCount { 0 };
 };
\ No newline at end of file
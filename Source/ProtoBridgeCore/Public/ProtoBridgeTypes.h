@@ -27,26 +27,59 @@ enum class EProtobufInt64Strategy : uint8
 
 struct FProtoSerializationContext;
 
-using FVariantEncoder = TFunction<bool(const FVariant&, google::protobuf::Value&, const FProtoSerializationContext&)>;
+using FVariantEncoderFunc = bool(*)(const FVariant&, google::protobuf::Value&, const FProtoSerializationContext&, void* UserData);
+
+struct FVariantEncoder
+{
+	FVariantEncoderFunc Func = nullptr;
+	void* UserData = nullptr;
+};
+
+/** Encoders indexed by EVariantTypes. Published tables are immutable; a registration swaps in a new copy. */
+struct FVariantEncoderTable
+{
+	static constexpr int32 NumTypes = static_cast<int32>(EVariantTypes::Custom) + 1;
+
+	FVariantEncoder Entries[NumTypes];
+
+	FORCEINLINE const FVariantEncoder* Find(EVariantTypes Type) const
+	{
+		const uint32 Index = static_cast<uint32>(Type);
+		return Index < static_cast<uint32>(NumTypes) && Entries[Index].Func ? &Entries[Index] : nullptr;
+	}
+
+	void Set(EVariantTypes Type, FVariantEncoderFunc Func, void* UserData = nullptr)
+	{
+		const uint32 Index = static_cast<uint32>(Type);
+		if (Index < static_cast<uint32>(NumTypes))
+		{
+			Entries[Index] = { Func, UserData };
+		}
+	}
+};
 
 struct PROTOBRIDGECORE_API FProtoSerializationContext
 {
 	EProtobufInt64Strategy Int64Strategy;
-	TSharedPtr<TMap<EVariantTypes, FVariantEncoder>, ESPMode::ThreadSafe> Encoders;
+	const FVariantEncoderTable* Encoders;
 	
 	int32 MaxAnyPayloadSize;
 	int32 MaxByteArraySize;
 	int32 MaxJsonRecursionDepth;
 	bool bBestEffortJsonParsing;
+	/** Snapshot version from UProtoBridgeSubsystem; 0 for contexts built by hand. */
+	uint32 Version;
 	
 	mutable bool bHasWarnedPrecisionLoss;
 
 	FProtoSerializationContext()
 		: Int64Strategy(EProtobufInt64Strategy::AlwaysString)
+		, Encoders(nullptr)
 		, MaxAnyPayloadSize(32 * 1024 * 1024)
 		, MaxByteArraySize(64 * 1024 * 1024)
 		, MaxJsonRecursionDepth(75)
 		, bBestEffortJsonParsing(false)
+		, Version(0)
 		, bHasWarnedPrecisionLoss(false)
 	{}
 };
\ No newline at end of file
@@ -0,0 +1,47 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "ProtobufIncludes.h"
+
+/** One message level of a compiled field mask. Bits and children are indexed by descriptor field index. */
+struct PROTOBRIDGECORE_API FProtoFieldMaskNode
+{
+	TArray<uint64> Words;
+	/** A null child on an included field means the whole field is selected. */
+	TArray<TUniquePtr<FProtoFieldMaskNode>> Children;
+
+	FORCEINLINE bool Includes(int32 FieldIndex) const
+	{
+		const int32 Word = FieldIndex / 64;
+		return Word < Words.Num() && (Words[Word] & (1ull << (FieldIndex % 64))) != 0;
+	}
+
+	FORCEINLINE const FProtoFieldMaskNode* GetChild(int32 FieldIndex) const
+	{
+		return Children.IsValidIndex(FieldIndex) ? Children[FieldIndex].Get() : nullptr;
+	}
+};
+
+/** Immutable set of google.protobuf.FieldMask paths. Each message type the mask is applied to is compiled once into an FProtoFieldMaskNode tree and cached on the mask. */
+class PROTOBRIDGECORE_API FProtoFieldMask
+{
+public:
+	FProtoFieldMask() = default;
+	explicit FProtoFieldMask(TArray<FString> InPaths);
+
+	static void FieldMaskToProto(const FProtoFieldMask& In, google::protobuf::FieldMask& Out);
+	static FProtoFieldMask ProtoToFieldMask(const google::protobuf::FieldMask& In);
+
+	const TArray<FString>& GetPaths() const;
+	bool IsEmpty() const { return GetPaths().Num() == 0; }
+
+	/** Paths may use proto or lowerCamelCase field names. Unknown or non-message intermediate segments are logged and skipped. */
+	const FProtoFieldMaskNode& Compile(const google::protobuf::Descriptor* Descriptor) const;
+
+	bool operator==(const FProtoFieldMask& Other) const;
+	bool operator!=(const FProtoFieldMask& Other) const { return !(*this == Other); }
+
+private:
+	struct FState;
+	TSharedPtr<FState, ESPMode::ThreadSafe> State;
+};
\ No newline at end of file
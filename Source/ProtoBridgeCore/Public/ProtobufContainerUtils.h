@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "ProtobufStringUtils.h"
 #include "ProtobufIncludes.h"
+#include "ProtoBridgeMemory.h"
 #include <type_traits>
 
 namespace google {
@@ -42,6 +43,7 @@ public:
 	template <typename T_UE, typename T_Proto>
 	static void TArrayToRepeatedField(const TArray<T_UE>& InArray, google::protobuf::RepeatedField<T_Proto>* OutField)
 	{
+		LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 		if (!OutField) return;
 		OutField->Clear();
 		const int32 Num = InArray.Num();
@@ -68,6 +70,7 @@ public:
 	template <typename T_UE, typename T_Proto>
 	static void RepeatedFieldToTArray(const google::protobuf::RepeatedField<T_Proto>& InField, TArray<T_UE>& OutArray)
 	{
+		LLM_SCOPE_BYTAG(ProtoBridge_Decode);
 		const int32 Num = InField.size();
 		OutArray.Reset(Num);
 		if (Num == 0) return;
@@ -91,6 +94,7 @@ public:
 
 	static void TArrayToRepeatedPtrField(const TArray<FString>& InArray, google::protobuf::RepeatedPtrField<std::string>* OutField)
 	{
+		LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 		if (!OutField) return;
 		OutField->Clear();
 		OutField->Reserve(InArray.Num());
@@ -102,6 +106,7 @@ public:
 
 	static void RepeatedPtrFieldToTArray(const google::protobuf::RepeatedPtrField<std::string>& InField, TArray<FString>& OutArray)
 	{
+		LLM_SCOPE_BYTAG(ProtoBridge_Decode);
 		OutArray.Reset(InField.size());
 		for (const std::string& Elem : InField)
 		{
@@ -112,6 +117,7 @@ public:
 	template <typename T_UE, typename T_ProtoMessage, typename FConverter>
 	static void TArrayToRepeatedMessage(const TArray<T_UE>& InArray, google::protobuf::RepeatedPtrField<T_ProtoMessage>* OutField, FConverter Converter)
 	{
+		LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 		if (!OutField) return;
 		OutField->Clear();
 		OutField->Reserve(InArray.Num());
@@ -121,12 +127,14 @@ public:
 	template <typename T_UE, typename T_ProtoMessage, typename FConverter>
 	static void RepeatedMessageToTArray(const google::protobuf::RepeatedPtrField<T_ProtoMessage>& InField, TArray<T_UE>& OutArray, FConverter Converter)
 	{
+		LLM_SCOPE_BYTAG(ProtoBridge_Decode);
 		OutArray.Reset(InField.size());
 		for (const T_ProtoMessage& Elem : InField) OutArray.Emplace(Converter(Elem));
 	}
 
 	template <typename KeyType, typename ValueType, typename ProtoMap>
 	static void TMapToProtoMap(const TMap<KeyType, ValueType>& InMap, ProtoMap* OutMap) {
+		LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 		if (!OutMap) return;
 		OutMap->clear();
 		for (const auto& Pair : InMap) {
@@ -138,6 +146,7 @@ public:
 
 	template <typename KeyType, typename ValueType, typename ProtoMap>
 	static void ProtoMapToTMap(const ProtoMap& InMap, TMap<KeyType, ValueType>& OutMap) {
+		LLM_SCOPE_BYTAG(ProtoBridge_Decode);
 		OutMap.Reset();
 		OutMap.Reserve(InMap.size());
 		for (const auto& Pair : InMap) {
@@ -149,6 +158,7 @@ public:
 
 	template <typename T_UE, typename T_Proto>
 	static void TSetToRepeatedField(const TSet<T_UE>& InSet, google::protobuf::RepeatedField<T_Proto>* OutField) {
+		LLM_SCOPE_BYTAG(ProtoBridge_Encode);
 		if (!OutField) return;
 		OutField->Clear();
 		OutField->Reserve(InSet.Num());
@@ -159,6 +169,7 @@ public:
 
 	template <typename T_UE, typename T_Proto>
 	static void RepeatedFieldToTSet(const google::protobuf::RepeatedField<T_Proto>& InField, TSet<T_UE>& OutSet) {
+		LLM_SCOPE_BYTAG(ProtoBridge_Decode);
 		OutSet.Reset();
 		OutSet.Reserve(InField.size());
 		for (const T_Proto& Elem : InField) {
@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "ProtobufAny.h"
+#include "ProtobufIncludes.h"
+
+class PROTOBRIDGECORE_API FProtobufDeltaUtils
+{
+public:
+	/** Field number of the presence words, taken from the range protobuf reserves for its own use so it can never collide with a schema field. */
+	static constexpr int32 PresenceFieldNumber = 19000;
+
+	static constexpr int32 GetPresenceWordCount(int32 NumBits) { return (NumBits + 63) / 64; }
+
+	static void SetPresenceBit(uint64* Words, int32 Bit) { Words[Bit / 64] |= 1ull << (Bit % 64); }
+	static bool HasPresenceBit(const uint64* Words, int32 Bit) { return (Words[Bit / 64] & (1ull << (Bit % 64))) != 0; }
+
+	/** Stores the mask as unknown varint fields on the delta message, omitting trailing zero words but always writing at least one. Returns true if any bit is set. */
+	static bool WritePresenceMask(google::protobuf::Message& Proto, const uint64* Words, int32 NumWords);
+	/** Returns false when the message carries no mask, i.e. it was not produced by ToProtoDelta. */
+	static bool ReadPresenceMask(const google::protobuf::Message& Proto, uint64* Words, int32 NumWords);
+
+	template <typename T>
+	static bool IsEqual(const T& A, const T& B) { return A == B; }
+
+	static bool IsEqual(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static bool IsEqual(const FText& A, const FText& B) { return A.IdenticalTo(B) || A.ToString().Equals(B.ToString(), ESearchCase::CaseSensitive); }
+	static bool IsEqual(const FTransform& A, const FTransform& B) { return A.Equals(B, 0.0); }
+	static bool IsEqual(const FProtobufAny& A, const FProtobufAny& B) { return IsEqual(A.TypeUrl, B.TypeUrl) && A.Value == B.Value; }
+
+	/** Struct, Value and ListValue map to shared JSON nodes that a baseline copy aliases, so these compare by content rather than by pointer. */
+	static bool IsEqual(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+	{
+		if (A == B) return true;
+		return A.IsValid() && B.IsValid() && FJsonValue::CompareEqual(*A, *B);
+	}
+	static bool IsEqual(const TSharedPtr<FJsonObject>& A, const TSharedPtr<FJsonObject>& B)
+	{
+		if (A == B) return true;
+		return A.IsValid() && B.IsValid() && FJsonValue::CompareEqual(FJsonValueObject(A), FJsonValueObject(B));
+	}
+	static bool IsEqual(const TArray<TSharedPtr<FJsonValue>>& A, const TArray<TSharedPtr<FJsonValue>>& B)
+	{
+		return FJsonValue::CompareEqual(FJsonValueArray(A), FJsonValueArray(B));
+	}
+
+	template <typename T, typename T_Allocator>
+	static bool IsEqual(const TArray<T, T_Allocator>& A, const TArray<T, T_Allocator>& B)
+	{
+		if (A.Num() != B.Num()) return false;
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			if (!IsEqual(A[Index], B[Index])) return false;
+		}
+		return true;
+	}
+
+	template <typename T_Key, typename T_Value>
+	static bool IsEqual(const TMap<T_Key, T_Value>& A, const TMap<T_Key, T_Value>& B)
+	{
+		if (A.Num() != B.Num()) return false;
+		for (const TPair<T_Key, T_Value>& Elem : A)
+		{
+			const T_Value* Other = B.Find(Elem.Key);
+			if (!Other || !IsEqual(Elem.Value, *Other)) return false;
+		}
+		return true;
+	}
+};
\ No newline at end of file
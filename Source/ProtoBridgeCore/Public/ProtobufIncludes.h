@@ -26,6 +26,9 @@
 
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/util/json_util.h>
 #include <google/protobuf/util/time_util.h>
 #include <google/protobuf/timestamp.pb.h>
@@ -33,6 +36,7 @@
 #include <google/protobuf/wrappers.pb.h>
 #include <google/protobuf/struct.pb.h>
 #include <google/protobuf/any.pb.h>
+#include <google/protobuf/field_mask.pb.h>
 
 #pragma warning(pop)
 
@@ -41,6 +41,26 @@ public:
 	static void FMatrixToRepeatedField(const FMatrix& InMatrix, google::protobuf::RepeatedField<double>* OutField);
 	static bool RepeatedFieldToFMatrix(const google::protobuf::RepeatedField<double>& InField, FMatrix& OutMatrix);
 
+	static constexpr int32 DefaultQuantizedVectorScale = 10;
+
+	static int32 GetQuantizedVectorScale();
+	static int32 QuantizeComponent(double Value, int32 Scale);
+	static double DequantizeComponent(int32 Value, int32 Scale);
+	static uint64 PackRotatorAngles(const FRotator& In);
+	static FRotator UnpackRotatorAngles(uint64 Packed);
+
+	static constexpr int32 CompressedQuatComponentBits = 20;
+	/** Worst-case absolute error of a reconstructed quaternion component. */
+	static constexpr double CompressedQuatMaxComponentError = 2.5e-6;
+
+	static uint64 CompressQuat(const FQuat& In);
+	static FQuat DecompressQuat(uint64 Packed);
+
+	/** Transform arrays travel as three packed streams (xyz, xyzw, xyz). Missing rotations or scales decode as identity. */
+	static void FTransformArrayToPackedDoubles(const TArray<FTransform>& InTransforms, double* OutLocations, double* OutRotations, double* OutScales);
+	static void PackedDoublesToFTransformArray(const double* InLocations, int32 NumLocations, const double* InRotations, int32 NumRotations, 
+		const double* InScales, int32 NumScales, TArray<FTransform>& OutTransforms);
+
 	template <typename T_Proto>
 	static bool FVectorToProto(const FVector& In, T_Proto* Out) {
 		static_assert(ProtoMathCheck::HasSetX<T_Proto>::value, "Proto message type must have set_x(double)");
@@ -56,6 +76,31 @@ public:
 		return FVector(In.x(), In.y(), In.z());
 	}
 
+	template <typename T_Proto>
+	static bool FVector3fToProto(const FVector3f& In, T_Proto* Out) {
+		if (!Out) return false;
+		Out->set_x(In.X); Out->set_y(In.Y); Out->set_z(In.Z);
+		return true;
+	}
+	template <typename T_Proto>
+	static FVector3f ProtoToFVector3f(const T_Proto& In) {
+		return FVector3f(In.x(), In.y(), In.z());
+	}
+
+	template <typename T_Proto>
+	static bool FVectorToQuantizedProto(const FVector& In, T_Proto* Out) {
+		if (!Out) return false;
+		const int32 Scale = GetQuantizedVectorScale();
+		Out->set_x(QuantizeComponent(In.X, Scale)); Out->set_y(QuantizeComponent(In.Y, Scale)); Out->set_z(QuantizeComponent(In.Z, Scale));
+		Out->set_scale(Scale == DefaultQuantizedVectorScale ? 0 : Scale);
+		return true;
+	}
+	template <typename T_Proto>
+	static FVector ProtoToFVectorQuantized(const T_Proto& In) {
+		const int32 Scale = static_cast<int32>(In.scale());
+		return FVector(DequantizeComponent(In.x(), Scale), DequantizeComponent(In.y(), Scale), DequantizeComponent(In.z(), Scale));
+	}
+
 	template <typename T_Proto>
 	static bool FVector2DToProto(const FVector2D& In, T_Proto* Out) {
 		static_assert(ProtoMathCheck::HasSetX<T_Proto>::value, "Proto message type must have set_x(double)");
@@ -107,6 +152,28 @@ public:
 		return FRotator(In.pitch(), In.yaw(), In.roll());
 	}
 
+	template <typename T_Proto>
+	static bool FRotator3fToProto(const FRotator3f& In, T_Proto* Out) {
+		if (!Out) return false;
+		Out->set_pitch(In.Pitch); Out->set_yaw(In.Yaw); Out->set_roll(In.Roll);
+		return true;
+	}
+	template <typename T_Proto>
+	static FRotator3f ProtoToFRotator3f(const T_Proto& In) {
+		return FRotator3f(In.pitch(), In.yaw(), In.roll());
+	}
+
+	template <typename T_Proto>
+	static bool FRotatorToQuantizedProto(const FRotator& In, T_Proto* Out) {
+		if (!Out) return false;
+		Out->set_packed_angles(PackRotatorAngles(In));
+		return true;
+	}
+	template <typename T_Proto>
+	static FRotator ProtoToFRotatorQuantized(const T_Proto& In) {
+		return UnpackRotatorAngles(In.packed_angles());
+	}
+
 	template <typename T_Proto>
 	static bool FQuatToProto(const FQuat& In, T_Proto* Out) {
 		static_assert(ProtoMathCheck::HasSetW<T_Proto>::value, "Proto message type must have set_w");
@@ -153,6 +220,17 @@ public:
 		return FLinearColor(InProto.r(), InProto.g(), InProto.b(), InProto.a());
 	}
 
+	template <typename T_Proto>
+	static bool FQuatToCompressedProto(const FQuat& In, T_Proto* Out) {
+		if (!Out) return false;
+		Out->set_packed(CompressQuat(In));
+		return true;
+	}
+	template <typename T_Proto>
+	static FQuat ProtoToFQuatCompressed(const T_Proto& In) {
+		return DecompressQuat(In.packed());
+	}
+
 	template <typename T_Proto>
 	static bool FTransformToProto(const FTransform& InTransform, T_Proto* OutProto) {
 		if (!OutProto) return false;
@@ -223,6 +301,62 @@ public:
 		return Result;
 	}
 
+	template <typename T_Proto>
+	static bool FVector2DArrayToProto(const TArray<FVector2D>& In, T_Proto* Out) {
+		if (!Out) return false;
+		CopyToPackedField(In, Out->mutable_xy());
+		return true;
+	}
+	template <typename T_Proto>
+	static TArray<FVector2D> ProtoToFVector2DArray(const T_Proto& In) {
+		TArray<FVector2D> Result;
+		CopyFromPackedField(In.xy(), Result);
+		return Result;
+	}
+
+	template <typename T_Proto>
+	static bool FVectorArrayToProto(const TArray<FVector>& In, T_Proto* Out) {
+		if (!Out) return false;
+		CopyToPackedField(In, Out->mutable_xyz());
+		return true;
+	}
+	template <typename T_Proto>
+	static TArray<FVector> ProtoToFVectorArray(const T_Proto& In) {
+		TArray<FVector> Result;
+		CopyFromPackedField(In.xyz(), Result);
+		return Result;
+	}
+
+	template <typename T_Proto>
+	static bool FQuatArrayToProto(const TArray<FQuat>& In, T_Proto* Out) {
+		if (!Out) return false;
+		CopyToPackedField(In, Out->mutable_xyzw());
+		return true;
+	}
+	template <typename T_Proto>
+	static TArray<FQuat> ProtoToFQuatArray(const T_Proto& In) {
+		TArray<FQuat> Result;
+		CopyFromPackedField(In.xyzw(), Result);
+		return Result;
+	}
+
+	template <typename T_Proto>
+	static bool FTransformArrayToProto(const TArray<FTransform>& In, T_Proto* Out) {
+		if (!Out) return false;
+		Out->mutable_location_xyz()->Resize(In.Num() * 3, 0.0);
+		Out->mutable_rotation_xyzw()->Resize(In.Num() * 4, 0.0);
+		Out->mutable_scale_xyz()->Resize(In.Num() * 3, 0.0);
+		FTransformArrayToPackedDoubles(In, Out->mutable_location_xyz()->mutable_data(), Out->mutable_rotation_xyzw()->mutable_data(), Out->mutable_scale_xyz()->mutable_data());
+		return true;
+	}
+	template <typename T_Proto>
+	static TArray<FTransform> ProtoToFTransformArray(const T_Proto& In) {
+		TArray<FTransform> Result;
+		PackedDoublesToFTransformArray(In.location_xyz().data(), In.location_xyz_size(), In.rotation_xyzw().data(), In.rotation_xyzw_size(), 
+			In.scale_xyz().data(), In.scale_xyz_size(), Result);
+		return Result;
+	}
+
 	template <typename T_Proto>
 	static bool FSphereToProto(const FSphere& InSphere, T_Proto* OutProto) {
 		if (!OutProto) return false;
@@ -237,4 +371,21 @@ public:
 		Result.W = InProto.w();
 		return Result;
 	}
+
+private:
+	template <typename T_Element, typename T_Field>
+	static void CopyToPackedField(const TArray<T_Element>& In, T_Field* OutField) {
+		static_assert(sizeof(T_Element) % sizeof(double) == 0, "Element must be a tightly packed run of doubles");
+		constexpr int32 Components = sizeof(T_Element) / sizeof(double);
+		OutField->Resize(In.Num() * Components, 0.0);
+		if (In.Num() > 0) FMemory::Memcpy(OutField->mutable_data(), In.GetData(), In.Num() * sizeof(T_Element));
+	}
+
+	template <typename T_Element, typename T_Field>
+	static void CopyFromPackedField(const T_Field& InField, TArray<T_Element>& Out) {
+		static_assert(sizeof(T_Element) % sizeof(double) == 0, "Element must be a tightly packed run of doubles");
+		constexpr int32 Components = sizeof(T_Element) / sizeof(double);
+		Out.SetNumUninitialized(InField.size() / Components);
+		if (Out.Num() > 0) FMemory::Memcpy(Out.GetData(), InField.data(), Out.Num() * sizeof(T_Element));
+	}
 };
\ No newline at end of file
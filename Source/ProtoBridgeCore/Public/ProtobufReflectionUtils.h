@@ -6,6 +6,7 @@
 #include "GameplayTagContainer.h"
 #include "UObject/SoftObjectPath.h"
 #include "ProtobufStringUtils.h"
+#include "ProtoBridgeNameCache.h"
 #include "ProtoBridgeTypes.h"
 #include "ProtoBridgeLogs.h"
 #include "Containers/StringConv.h"
@@ -14,6 +15,7 @@ namespace google {
 namespace protobuf {
 	class Any;
 	class Value;
+	class ListValue;
 }
 }
 
@@ -22,6 +24,8 @@ class PROTOBRIDGECORE_API FProtobufReflectionUtils
 public:
 	static bool FVariantToProtoValue(const FVariant& InVariant, google::protobuf::Value& OutValue, const FProtoSerializationContext& Context);
 	static FVariant ProtoValueToFVariant(const google::protobuf::Value& InValue);
+	/** OutList is only replaced once every variant has encoded. */
+	static bool EncodeVariants(TConstArrayView<FVariant> InVariants, google::protobuf::ListValue& OutList, const FProtoSerializationContext& Context);
 	
 	static bool ConvertInt64ToProtoValue(int64 InVal, google::protobuf::Value& OutValue, const FProtoSerializationContext& Context);
 
@@ -60,21 +64,10 @@ public:
 		const std::string& Str = InProto.tag_name();
 		if (Str.empty()) return FGameplayTag();
 
-		const int32 SrcLen = static_cast<int32>(Str.length());
-		const int32 DestLen = FUTF8ToTCHAR_Convert::ConvertedLength(Str.data(), SrcLen);
-		
-		TArray<TCHAR, TInlineAllocator<NAME_SIZE>> Buffer;
-		Buffer.AddUninitialized(DestLen + 1);
-		FUTF8ToTCHAR_Convert::Convert(Buffer.GetData(), DestLen, Str.data(), SrcLen);
-		Buffer[DestLen] = 0;
-
-		const FName TagName(Buffer.GetData());
-		if (TagName.IsNone()) return FGameplayTag();
-
-		FGameplayTag Result = FGameplayTag::RequestGameplayTag(TagName, false);
+		FGameplayTag Result = FProtoBridgeNameCache::ResolveGameplayTag(Str.data(), static_cast<int32>(Str.length()));
 		if (!Result.IsValid())
 		{
-			UE_LOG(LogProtoBridgeCore, Warning, TEXT("ProtoToFGameplayTag: Tag '%s' not found."), *TagName.ToString());
+			UE_LOG(LogProtoBridgeCore, Warning, TEXT("ProtoToFGameplayTag: Tag '%s' not found."), *FProtobufStringUtils::StdStringToFString(Str));
 		}
 		return Result; 
 	}
@@ -93,26 +86,14 @@ public:
 		{
 			if (TagStr.empty()) continue;
 
-			const int32 SrcLen = static_cast<int32>(TagStr.length());
-			const int32 DestLen = FUTF8ToTCHAR_Convert::ConvertedLength(TagStr.data(), SrcLen);
-			
-			TArray<TCHAR, TInlineAllocator<NAME_SIZE>> Buffer;
-			Buffer.AddUninitialized(DestLen + 1);
-			FUTF8ToTCHAR_Convert::Convert(Buffer.GetData(), DestLen, TagStr.data(), SrcLen);
-			Buffer[DestLen] = 0;
-
-			const FName TagName(Buffer.GetData());
-			if (!TagName.IsNone())
+			FGameplayTag Tag = FProtoBridgeNameCache::ResolveGameplayTag(TagStr.data(), static_cast<int32>(TagStr.length()));
+			if (Tag.IsValid())
+			{
+				Result.AddTag(Tag);
+			}
+			else
 			{
-				FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagName, false);
-				if (Tag.IsValid())
-				{
-					Result.AddTag(Tag);
-				}
-				else
-				{
-					UE_LOG(LogProtoBridgeCore, Warning, TEXT("ProtoToFGameplayTagContainer: Tag '%s' not found."), *TagName.ToString());
-				}
+				UE_LOG(LogProtoBridgeCore, Warning, TEXT("ProtoToFGameplayTagContainer: Tag '%s' not found."), *FProtobufStringUtils::StdStringToFString(TagStr));
 			}
 		}
 		return Result;
@@ -0,0 +1,91 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Memory/MemoryView.h"
+#include "ProtobufIncludes.h"
+
+class PROTOBRIDGECORE_API FProtoArchiveInputStream : public google::protobuf::io::ZeroCopyInputStream
+{
+public:
+	static constexpr int32 DefaultBlockSize = 64 * 1024;
+
+	/** Streams Length bytes from the archive's current position, or everything up to TotalSize() when Length is negative. */
+	explicit FProtoArchiveInputStream(FArchive& InArchive, int64 InLength = -1, int32 InBlockSize = DefaultBlockSize);
+
+	virtual bool Next(const void** Data, int* Size) override;
+	virtual void BackUp(int Count) override;
+	virtual bool Skip(int Count) override;
+	virtual int64_t ByteCount() const override;
+
+	int64 GetRemaining() const { return Remaining + BackUpCount; }
+
+private:
+	FArchive& Archive;
+	TArray<uint8> Buffer;
+	int64 Remaining;
+	int64 Position;
+	int32 BufferUsed;
+	int32 BackUpCount;
+};
+
+class PROTOBRIDGECORE_API FProtobufStreamUtils
+{
+public:
+	static bool ParseFromView(FMemoryView InView, google::protobuf::MessageLite& OutMessage);
+	static bool ParseFromArchive(FArchive& Ar, int64 Length, google::protobuf::MessageLite& OutMessage);
+
+	template <typename T_Struct>
+	static bool ParseDirectFromView(FMemoryView InView, T_Struct& OutStruct)
+	{
+		if (!CheckViewSize(InView)) return false;
+		return OutStruct.ParseDirect(static_cast<const uint8*>(InView.GetData()), static_cast<int32>(InView.GetSize()));
+	}
+
+	template <typename T_Struct>
+	static bool ParseDirectFromArchive(FArchive& Ar, int64 Length, T_Struct& OutStruct)
+	{
+		FProtoArchiveInputStream Input(Ar, Length);
+		if (!CheckStreamSize(Input)) return false;
+
+		google::protobuf::io::CodedInputStream Stream(&Input);
+		Stream.PushLimit(static_cast<int>(Input.GetRemaining()));
+		return OutStruct.ParseDirectFromStream(Stream) && !Ar.IsError();
+	}
+
+	/** Appends one varint length-delimited record (writeDelimitedTo framing); RecordWriter fills the Size payload bytes in place. */
+	template <typename T_Writer>
+	static bool AppendDelimited(TArray<uint8>& Buffer, size_t Size, T_Writer&& RecordWriter)
+	{
+		const size_t RecordSize = google::protobuf::io::CodedOutputStream::VarintSize64(Size) + Size;
+		if (RecordSize > static_cast<size_t>(MAX_int32 - Buffer.Num())) return false;
+
+		const int32 Offset = Buffer.Num();
+		Buffer.AddUninitialized(static_cast<int32>(RecordSize));
+		uint8* Target = google::protobuf::io::CodedOutputStream::WriteVarint64ToArray(Size, Buffer.GetData() + Offset);
+		return RecordWriter(Target, static_cast<int32>(Size));
+	}
+
+	/** Walks consecutive varint length-delimited records, handing each payload to RecordReader without copying. */
+	template <typename T_Reader>
+	static bool ForEachDelimited(FMemoryView InView, T_Reader&& RecordReader)
+	{
+		if (!CheckViewSize(InView)) return false;
+
+		google::protobuf::io::CodedInputStream Stream(static_cast<const uint8*>(InView.GetData()), static_cast<int>(InView.GetSize()));
+		while (!Stream.ExpectAtEnd())
+		{
+			uint32 Length = 0;
+			const void* Data = nullptr;
+			int Available = 0;
+			if (!Stream.ReadVarint32(&Length) || Length > static_cast<uint32>(MAX_int32)) return false;
+			if (Length > 0 && (!Stream.GetDirectBufferPointer(&Data, &Available) || static_cast<uint32>(Available) < Length)) return false;
+			if (!RecordReader(static_cast<const uint8*>(Data), static_cast<int32>(Length))) return false;
+			if (!Stream.Skip(static_cast<int>(Length))) return false;
+		}
+		return true;
+	}
+
+private:
+	static bool CheckViewSize(FMemoryView InView);
+	static bool CheckStreamSize(const FProtoArchiveInputStream& Input);
+};
\ No newline at end of file
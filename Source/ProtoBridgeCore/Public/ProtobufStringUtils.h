@@ -12,12 +12,19 @@ public:
 
 	static void StdStringToFString(const std::string& InStr, FString& OutStr);
 	static FString StdStringToFString(const std::string& InStr);
+	static void Utf8ToFString(const ANSICHAR* InData, int32 InLen, FString& OutStr);
+	/** UTF-8 length of InStr as FStringToStdString encodes it. */
+	static int32 Utf8Length(FStringView InStr);
+	/** Encodes InStr into Dest, which must hold Utf8Length(InStr) bytes; returns the bytes written. */
+	static int32 FStringToUtf8(FStringView InStr, ANSICHAR* Dest);
 
 	static void FNameToStdString(const FName& InName, std::string& OutStr);
 	static std::string FNameToStdString(const FName& InName);
 
 	static void StdStringToFName(const std::string& InStr, FName& OutName);
 	static FName StdStringToFName(const std::string& InStr);
+	/** Uncached conversion; StdStringToFName goes through FProtoBridgeNameCache. */
+	static FName Utf8ToFName(const ANSICHAR* InData, int32 InLen);
 
 	static void FTextToStdString(const FText& InText, std::string& OutStr);
 	static std::string FTextToStdString(const FText& InText);
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "ProtoBridgeTypes.h"
 
 namespace google {
@@ -18,6 +20,8 @@ class PROTOBRIDGECORE_API FProtobufStructUtils
 public:
 	static TSharedPtr<FJsonObject> ProtoStructToJsonObject(const google::protobuf::Struct& InStruct, const FProtoSerializationContext& Context);
 	static bool JsonObjectToProtoStruct(const TSharedPtr<FJsonObject>& InJson, google::protobuf::Struct& OutStruct, const FProtoSerializationContext& Context);
+	/** Pulls tokens straight into OutStruct without an FJsonObject DOM. OutStruct is left untouched on failure. */
+	static bool JsonStringToProtoStruct(FUtf8StringView InJson, google::protobuf::Struct& OutStruct, const FProtoSerializationContext& Context);
 
 	static TSharedPtr<FJsonValue> ProtoValueToJsonValue(const google::protobuf::Value& InValue, const FProtoSerializationContext& Context);
 	static bool JsonValueToProtoValue(const TSharedPtr<FJsonValue>& InJson, google::protobuf::Value& OutValue, const FProtoSerializationContext& Context);
@@ -25,6 +29,18 @@ public:
 	static bool JsonListToProto(const TArray<TSharedPtr<FJsonValue>>& InList, google::protobuf::ListValue& OutList, const FProtoSerializationContext& Context);
 	static TArray<TSharedPtr<FJsonValue>> ProtoToJsonList(const google::protobuf::ListValue& InList, const FProtoSerializationContext& Context);
 
+	/** Streams straight to the writer without building a DOM. OutJson is left untouched on failure. */
+	static bool ProtoStructToJsonString(const google::protobuf::Struct& InStruct, FString& OutJson, const FProtoSerializationContext& Context);
+	static bool ProtoStructToJsonString(const google::protobuf::Struct& InStruct, TArray<uint8>& OutUtf8, const FProtoSerializationContext& Context);
+
+	/** Instantiated for TCHAR and UTF8CHAR writers with the condensed and pretty print policies. */
+	template <class CharType, class PrintPolicy>
+	static bool WriteProtoStruct(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::Struct& InStruct, const FProtoSerializationContext& Context);
+	template <class CharType, class PrintPolicy>
+	static bool WriteProtoValue(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::Value& InValue, const FProtoSerializationContext& Context);
+	template <class CharType, class PrintPolicy>
+	static bool WriteProtoList(TJsonWriter<CharType, PrintPolicy>& Writer, const google::protobuf::ListValue& InList, const FProtoSerializationContext& Context);
+
 private:
 	static TSharedPtr<FJsonObject> ProtoStructToJsonObjectInternal(const google::protobuf::Struct& InStruct, int32 CurrentDepth, const FProtoSerializationContext& Context);
 	static bool JsonObjectToProtoStructInternal(const TSharedPtr<FJsonObject>& InJson, google::protobuf::Struct& OutStruct, int32 CurrentDepth, const FProtoSerializationContext& Context);
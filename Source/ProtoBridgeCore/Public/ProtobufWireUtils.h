@@ -0,0 +1,483 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "ProtobufIncludes.h"
+#include <type_traits>
+
+enum class EProtoWireType : uint8
+{
+	Int32,
+	Int64,
+	UInt32,
+	UInt64,
+	SInt32,
+	SInt64,
+	Fixed32,
+	Fixed64,
+	SFixed32,
+	SFixed64,
+	Float,
+	Double,
+	Bool,
+	Enum
+};
+
+namespace ProtoWire
+{
+	using FWireFormat = google::protobuf::internal::WireFormatLite;
+	using FOutputStream = google::protobuf::io::CodedOutputStream;
+	using FInputStream = google::protobuf::io::CodedInputStream;
+
+	template <EProtoWireType Type> struct TScalar;
+
+#define PROTOWIRE_VARINT_SCALAR(WireTypeName, ProtoTypeName, SizeFunc, FieldTypeValue) \
+	template <> struct TScalar<EProtoWireType::WireTypeName> \
+	{ \
+		using ProtoType = ProtoTypeName; \
+		static constexpr FWireFormat::WireType WireType = FWireFormat::WIRETYPE_VARINT; \
+		static constexpr size_t FixedSize = 0; \
+		static size_t Size(ProtoType Value) { return FWireFormat::SizeFunc(Value); } \
+		static void Write(ProtoType Value, FOutputStream& Stream) { FWireFormat::Write##WireTypeName##NoTag(Value, &Stream); } \
+		static bool Read(FInputStream& Stream, ProtoType& Value) { return FWireFormat::ReadPrimitive<ProtoType, FWireFormat::FieldTypeValue>(&Stream, &Value); } \
+	};
+
+#define PROTOWIRE_FIXED_SCALAR(WireTypeName, ProtoTypeName, WireTypeValue, FieldTypeValue) \
+	template <> struct TScalar<EProtoWireType::WireTypeName> \
+	{ \
+		using ProtoType = ProtoTypeName; \
+		static constexpr FWireFormat::WireType WireType = FWireFormat::WireTypeValue; \
+		static constexpr size_t FixedSize = sizeof(ProtoTypeName); \
+		static size_t Size(ProtoType) { return FixedSize; } \
+		static void Write(ProtoType Value, FOutputStream& Stream) { FWireFormat::Write##WireTypeName##NoTag(Value, &Stream); } \
+		static bool Read(FInputStream& Stream, ProtoType& Value) { return FWireFormat::ReadPrimitive<ProtoType, FWireFormat::FieldTypeValue>(&Stream, &Value); } \
+	};
+
+	PROTOWIRE_VARINT_SCALAR(Int32, int32_t, Int32Size, TYPE_INT32)
+	PROTOWIRE_VARINT_SCALAR(Int64, int64_t, Int64Size, TYPE_INT64)
+	PROTOWIRE_VARINT_SCALAR(UInt32, uint32_t, UInt32Size, TYPE_UINT32)
+	PROTOWIRE_VARINT_SCALAR(UInt64, uint64_t, UInt64Size, TYPE_UINT64)
+	PROTOWIRE_VARINT_SCALAR(SInt32, int32_t, SInt32Size, TYPE_SINT32)
+	PROTOWIRE_VARINT_SCALAR(SInt64, int64_t, SInt64Size, TYPE_SINT64)
+	PROTOWIRE_VARINT_SCALAR(Enum, int, EnumSize, TYPE_ENUM)
+	PROTOWIRE_FIXED_SCALAR(Fixed32, uint32_t, WIRETYPE_FIXED32, TYPE_FIXED32)
+	PROTOWIRE_FIXED_SCALAR(Fixed64, uint64_t, WIRETYPE_FIXED64, TYPE_FIXED64)
+	PROTOWIRE_FIXED_SCALAR(SFixed32, int32_t, WIRETYPE_FIXED32, TYPE_SFIXED32)
+	PROTOWIRE_FIXED_SCALAR(SFixed64, int64_t, WIRETYPE_FIXED64, TYPE_SFIXED64)
+	PROTOWIRE_FIXED_SCALAR(Float, float, WIRETYPE_FIXED32, TYPE_FLOAT)
+	PROTOWIRE_FIXED_SCALAR(Double, double, WIRETYPE_FIXED64, TYPE_DOUBLE)
+
+	template <> struct TScalar<EProtoWireType::Bool>
+	{
+		using ProtoType = bool;
+		static constexpr FWireFormat::WireType WireType = FWireFormat::WIRETYPE_VARINT;
+		static constexpr size_t FixedSize = 1;
+		static size_t Size(ProtoType) { return 1; }
+		static void Write(ProtoType Value, FOutputStream& Stream) { FWireFormat::WriteBoolNoTag(Value, &Stream); }
+		static bool Read(FInputStream& Stream, ProtoType& Value) { return FWireFormat::ReadPrimitive<bool, FWireFormat::TYPE_BOOL>(&Stream, &Value); }
+	};
+
+#undef PROTOWIRE_FIXED_SCALAR
+#undef PROTOWIRE_VARINT_SCALAR
+
+	template <EProtoWireType Type, typename T_UE>
+	constexpr bool bIsRawWritable =
+		TScalar<Type>::FixedSize == sizeof(T_UE) &&
+		std::is_arithmetic_v<T_UE> &&
+		std::is_floating_point_v<T_UE> == std::is_floating_point_v<typename TScalar<Type>::ProtoType> &&
+		PLATFORM_LITTLE_ENDIAN;
+
+	template <EProtoWireType Type, typename T_UE>
+	constexpr bool bIsRawReadable = bIsRawWritable<Type, T_UE> && TScalar<Type>::WireType != FWireFormat::WIRETYPE_VARINT;
+}
+
+/**
+ * Nested struct sizes and converted messages recorded by ByteSizeDirect, consumed in the same order by
+ * SerializeDirectToStream so each subtree is measured once and each converted field is converted once.
+ */
+class FProtoDirectSizeCache
+{
+public:
+	int32 ReserveSize() { return Sizes.AddUninitialized(); }
+	void SetSize(int32 Slot, size_t Size) { Sizes[Slot] = Size; }
+	size_t ConsumeSize() { return Sizes[NextSize++]; }
+
+	template <typename T_Proto>
+	T_Proto& AddMessage() { return static_cast<T_Proto&>(*Messages.Emplace_GetRef(MakeUnique<T_Proto>())); }
+	const google::protobuf::MessageLite& ConsumeMessage() { return *Messages[NextMessage++]; }
+
+	void Reset()
+	{
+		Sizes.Reset();
+		Messages.Reset();
+		NextSize = 0;
+		NextMessage = 0;
+	}
+
+private:
+	TArray<size_t> Sizes;
+	TArray<TUniquePtr<google::protobuf::MessageLite>> Messages;
+	int32 NextSize = 0;
+	int32 NextMessage = 0;
+};
+
+class PROTOBRIDGECORE_API FProtobufWireUtils
+{
+public:
+	using FOutputStream = ProtoWire::FOutputStream;
+	using FInputStream = ProtoWire::FInputStream;
+	using FWireFormat = ProtoWire::FWireFormat;
+
+	static size_t TagSize(int32 FieldNumber)
+	{
+		return FOutputStream::VarintSize32(static_cast<uint32>(FieldNumber) << 3);
+	}
+
+	static void WriteTag(int32 FieldNumber, FWireFormat::WireType WireType, FOutputStream& Stream)
+	{
+		Stream.WriteTag(FWireFormat::MakeTag(FieldNumber, WireType));
+	}
+
+	static size_t LengthDelimitedSize(int32 FieldNumber, size_t Length)
+	{
+		return TagSize(FieldNumber) + FOutputStream::VarintSize64(Length) + Length;
+	}
+
+	template <typename T>
+	static bool IsNonDefault(const T& Value) { return Value != T(); }
+	static bool IsNonDefault(float Value) { uint32 Bits; FMemory::Memcpy(&Bits, &Value, sizeof(Bits)); return Bits != 0; }
+	static bool IsNonDefault(double Value) { uint64 Bits; FMemory::Memcpy(&Bits, &Value, sizeof(Bits)); return Bits != 0; }
+
+	template <EProtoWireType Type, typename T_UE>
+	static size_t ScalarFieldSize(int32 FieldNumber, const T_UE& Value)
+	{
+		using FScalar = ProtoWire::TScalar<Type>;
+		return TagSize(FieldNumber) + FScalar::Size(static_cast<typename FScalar::ProtoType>(Value));
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static void WriteScalarField(int32 FieldNumber, const T_UE& Value, FOutputStream& Stream)
+	{
+		using FScalar = ProtoWire::TScalar<Type>;
+		WriteTag(FieldNumber, FScalar::WireType, Stream);
+		FScalar::Write(static_cast<typename FScalar::ProtoType>(Value), Stream);
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static size_t ScalarFieldSizeIfSet(int32 FieldNumber, const T_UE& Value)
+	{
+		return IsNonDefault(Value) ? ScalarFieldSize<Type>(FieldNumber, Value) : 0;
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static void WriteScalarFieldIfSet(int32 FieldNumber, const T_UE& Value, FOutputStream& Stream)
+	{
+		if (IsNonDefault(Value)) WriteScalarField<Type>(FieldNumber, Value, Stream);
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static size_t PackedPayloadSize(const TArray<T_UE>& Values)
+	{
+		using FScalar = ProtoWire::TScalar<Type>;
+		if constexpr (FScalar::FixedSize > 0)
+		{
+			return static_cast<size_t>(Values.Num()) * FScalar::FixedSize;
+		}
+		else
+		{
+			size_t Result = 0;
+			for (const T_UE& Value : Values) Result += FScalar::Size(static_cast<typename FScalar::ProtoType>(Value));
+			return Result;
+		}
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static size_t PackedFieldSize(int32 FieldNumber, const TArray<T_UE>& Values)
+	{
+		if (Values.Num() == 0) return 0;
+		return LengthDelimitedSize(FieldNumber, PackedPayloadSize<Type>(Values));
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static void WritePackedField(int32 FieldNumber, const TArray<T_UE>& Values, FOutputStream& Stream)
+	{
+		using FScalar = ProtoWire::TScalar<Type>;
+		if (Values.Num() == 0) return;
+
+		WriteTag(FieldNumber, FWireFormat::WIRETYPE_LENGTH_DELIMITED, Stream);
+		const size_t PayloadSize = PackedPayloadSize<Type>(Values);
+		Stream.WriteVarint64(PayloadSize);
+
+		if constexpr (ProtoWire::bIsRawWritable<Type, T_UE>)
+		{
+			Stream.WriteRaw(Values.GetData(), static_cast<int>(PayloadSize));
+		}
+		else
+		{
+			for (const T_UE& Value : Values) FScalar::Write(static_cast<typename FScalar::ProtoType>(Value), Stream);
+		}
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static size_t RepeatedScalarFieldSize(int32 FieldNumber, const TArray<T_UE>& Values)
+	{
+		return static_cast<size_t>(Values.Num()) * TagSize(FieldNumber) + PackedPayloadSize<Type>(Values);
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static void WriteRepeatedScalarField(int32 FieldNumber, const TArray<T_UE>& Values, FOutputStream& Stream)
+	{
+		for (const T_UE& Value : Values) WriteScalarField<Type>(FieldNumber, Value, Stream);
+	}
+
+	/** The UTF-8 length is computed once here and kept in SizeCache; WriteStringField consumes it. */
+	static size_t StringFieldSize(int32 FieldNumber, FStringView Value, FProtoDirectSizeCache& SizeCache);
+	static void WriteStringField(int32 FieldNumber, FStringView Value, FProtoDirectSizeCache& SizeCache, FOutputStream& Stream);
+
+	static size_t BytesFieldSize(int32 FieldNumber, const TArray<uint8>& Value);
+	static void WriteBytesField(int32 FieldNumber, const TArray<uint8>& Value, FOutputStream& Stream);
+
+	static size_t MessageFieldSize(int32 FieldNumber, size_t MessageSize) { return LengthDelimitedSize(FieldNumber, MessageSize); }
+	static void WriteMessageHeader(int32 FieldNumber, size_t MessageSize, FOutputStream& Stream);
+	static void WriteMessageField(int32 FieldNumber, const google::protobuf::MessageLite& Message, FOutputStream& Stream);
+
+	/** The size pass reserves the struct's slot before recursing, so the write pass reads slots back in the same pre-order. */
+	template <typename T_Struct>
+	static size_t StructFieldSize(int32 FieldNumber, const T_Struct& Value, FProtoDirectSizeCache& SizeCache)
+	{
+		const int32 Slot = SizeCache.ReserveSize();
+		const size_t Size = Value.ByteSizeDirect(SizeCache);
+		SizeCache.SetSize(Slot, Size);
+		return MessageFieldSize(FieldNumber, Size);
+	}
+
+	template <typename T_Struct>
+	static void WriteStructField(int32 FieldNumber, const T_Struct& Value, FProtoDirectSizeCache& SizeCache, FOutputStream& Stream)
+	{
+		WriteMessageHeader(FieldNumber, SizeCache.ConsumeSize(), Stream);
+		Value.SerializeDirectToStream(Stream, SizeCache);
+	}
+
+	/** Converts into a message owned by SizeCache; WriteConvertedMessageField serializes that same message. */
+	template <typename T_Proto, typename T_UE, typename FConverter>
+	static size_t ConvertedMessageFieldSize(int32 FieldNumber, const T_UE& Value, FConverter Converter, FProtoDirectSizeCache& SizeCache)
+	{
+		T_Proto& Proto = SizeCache.AddMessage<T_Proto>();
+		Converter(Value, Proto);
+		return MessageFieldSize(FieldNumber, Proto.ByteSizeLong());
+	}
+
+	static void WriteConvertedMessageField(int32 FieldNumber, FProtoDirectSizeCache& SizeCache, FOutputStream& Stream);
+
+	static size_t FVectorSize(const FVector& In);
+	static void WriteFVector(const FVector& In, FOutputStream& Stream);
+
+	static size_t FVector3fSize(const FVector3f& In);
+	static void WriteFVector3f(const FVector3f& In, FOutputStream& Stream);
+
+	static size_t FVectorQuantizedSize(const FVector& In);
+	static void WriteFVectorQuantized(const FVector& In, FOutputStream& Stream);
+
+	static size_t FVector2DSize(const FVector2D& In);
+	static void WriteFVector2D(const FVector2D& In, FOutputStream& Stream);
+
+	static size_t FQuatSize(const FQuat& In);
+	static void WriteFQuat(const FQuat& In, FOutputStream& Stream);
+
+	static size_t FRotatorSize(const FRotator& In);
+	static void WriteFRotator(const FRotator& In, FOutputStream& Stream);
+
+	static size_t FQuatCompressedSize(const FQuat& In);
+	static void WriteFQuatCompressed(const FQuat& In, FOutputStream& Stream);
+
+	static size_t FRotator3fSize(const FRotator3f& In);
+	static void WriteFRotator3f(const FRotator3f& In, FOutputStream& Stream);
+
+	static size_t FRotatorQuantizedSize(const FRotator& In);
+	static void WriteFRotatorQuantized(const FRotator& In, FOutputStream& Stream);
+
+	static size_t FTransformSize(const FTransform& In);
+	static void WriteFTransform(const FTransform& In, FOutputStream& Stream);
+
+	static size_t FColorSize(const FColor& In);
+	static void WriteFColor(const FColor& In, FOutputStream& Stream);
+
+	static size_t FLinearColorSize(const FLinearColor& In);
+	static void WriteFLinearColor(const FLinearColor& In, FOutputStream& Stream);
+
+	static size_t FGuidSize(const FGuid& In);
+	static void WriteFGuid(const FGuid& In, FOutputStream& Stream);
+
+	static size_t FVector2DArraySize(const TArray<FVector2D>& In);
+	static void WriteFVector2DArray(const TArray<FVector2D>& In, FOutputStream& Stream);
+
+	static size_t FVectorArraySize(const TArray<FVector>& In);
+	static void WriteFVectorArray(const TArray<FVector>& In, FOutputStream& Stream);
+
+	static size_t FQuatArraySize(const TArray<FQuat>& In);
+	static void WriteFQuatArray(const TArray<FQuat>& In, FOutputStream& Stream);
+
+	static size_t FTransformArraySize(const TArray<FTransform>& In);
+	static void WriteFTransformArray(const TArray<FTransform>& In, FOutputStream& Stream);
+
+	static int32 GetTagFieldNumber(uint32 Tag) { return FWireFormat::GetTagFieldNumber(Tag); }
+	static bool SkipField(FInputStream& Stream, uint32 Tag) { return FWireFormat::SkipField(&Stream, Tag); }
+
+	template <EProtoWireType Type, typename T_UE>
+	static bool ReadScalarField(FInputStream& Stream, uint32 Tag, T_UE& Out)
+	{
+		using FScalar = ProtoWire::TScalar<Type>;
+		if (FWireFormat::GetTagWireType(Tag) != FScalar::WireType) return SkipField(Stream, Tag);
+
+		typename FScalar::ProtoType Value;
+		if (!FScalar::Read(Stream, Value)) return false;
+		Out = static_cast<T_UE>(Value);
+		return true;
+	}
+
+	template <EProtoWireType Type, typename T_UE>
+	static bool ReadRepeatedScalarField(FInputStream& Stream, uint32 Tag, TArray<T_UE>& Out)
+	{
+		using FScalar = ProtoWire::TScalar<Type>;
+		const FWireFormat::WireType WireType = FWireFormat::GetTagWireType(Tag);
+		if (WireType == FScalar::WireType)
+		{
+			typename FScalar::ProtoType Value;
+			if (!FScalar::Read(Stream, Value)) return false;
+			Out.Add(static_cast<T_UE>(Value));
+			return true;
+		}
+		if (WireType != FWireFormat::WIRETYPE_LENGTH_DELIMITED) return SkipField(Stream, Tag);
+
+		int Length;
+		if (!ReadLength(Stream, Length)) return false;
+
+		if constexpr (ProtoWire::bIsRawReadable<Type, T_UE>)
+		{
+			if (Length % FScalar::FixedSize != 0) return false;
+			const int32 Start = Out.Num();
+			Out.AddUninitialized(Length / static_cast<int32>(FScalar::FixedSize));
+			return Stream.ReadRaw(Out.GetData() + Start, Length);
+		}
+		else
+		{
+			const FInputStream::Limit Limit = Stream.PushLimit(Length);
+			if constexpr (FScalar::FixedSize > 0)
+			{
+				Out.Reserve(Out.Num() + Length / static_cast<int32>(FScalar::FixedSize));
+			}
+
+			bool bSuccess = true;
+			while (bSuccess && Stream.BytesUntilLimit() > 0)
+			{
+				typename FScalar::ProtoType Value;
+				bSuccess = FScalar::Read(Stream, Value);
+				if (bSuccess) Out.Add(static_cast<T_UE>(Value));
+			}
+			Stream.PopLimit(Limit);
+			return bSuccess;
+		}
+	}
+
+	static bool ReadStringField(FInputStream& Stream, uint32 Tag, FString& Out);
+	static bool ReadBytesField(FInputStream& Stream, uint32 Tag, TArray<uint8>& Out);
+
+	/** Reads a length-delimited sub-message. Reader consumes fields until the pushed limit and returns false on malformed input. */
+	template <typename FReader>
+	static bool ReadMessageField(FInputStream& Stream, uint32 Tag, FReader Reader)
+	{
+		if (FWireFormat::GetTagWireType(Tag) != FWireFormat::WIRETYPE_LENGTH_DELIMITED) return SkipField(Stream, Tag);
+
+		int Length;
+		if (!ReadLength(Stream, Length) || !Stream.IncrementRecursionDepth()) return false;
+
+		const FInputStream::Limit Limit = Stream.PushLimit(Length);
+		const bool bSuccess = Reader(Stream) && Stream.ConsumedEntireMessage();
+		Stream.PopLimit(Limit);
+		Stream.DecrementRecursionDepth();
+		return bSuccess;
+	}
+
+	/** Merges into Out rather than resetting it, so a singular message field repeated on the wire combines like MergeFromCodedStream. */
+	template <typename T_Struct>
+	static bool ReadStructField(FInputStream& Stream, uint32 Tag, T_Struct& Out)
+	{
+		return ReadMessageField(Stream, Tag, [&Out](FInputStream& InStream) { return Out.MergeDirectFromStream(InStream); });
+	}
+
+	template <typename T_UE, typename FBodyReader>
+	static bool ReadMessageField(FInputStream& Stream, uint32 Tag, T_UE& Out, FBodyReader BodyReader)
+	{
+		return ReadMessageField(Stream, Tag, [&Out, BodyReader](FInputStream& InStream) { return BodyReader(InStream, Out); });
+	}
+
+	template <typename T_Proto, typename T_UE, typename FConverter>
+	static bool ReadConvertedMessageField(FInputStream& Stream, uint32 Tag, T_UE& Out, FConverter Converter)
+	{
+		T_Proto Proto;
+		if (!ReadMessageField(Stream, Tag, [&Proto](FInputStream& InStream) { return Proto.MergePartialFromCodedStream(&InStream); })) return false;
+		Out = Converter(Proto);
+		return true;
+	}
+
+	template <typename T_UE, typename FReader>
+	static bool ReadRepeatedElement(FInputStream& Stream, uint32 Tag, TArray<T_UE>& Out, FReader Reader)
+	{
+		if (FWireFormat::GetTagWireType(Tag) != FWireFormat::WIRETYPE_LENGTH_DELIMITED) return SkipField(Stream, Tag);
+		return Reader(Out.AddDefaulted_GetRef());
+	}
+
+	template <typename T_Key, typename T_Value, typename FKeyReader, typename FValueReader>
+	static bool ReadMapEntryField(FInputStream& Stream, uint32 Tag, TMap<T_Key, T_Value>& Out, FKeyReader KeyReader, FValueReader ValueReader)
+	{
+		T_Key Key = T_Key();
+		T_Value Value = T_Value();
+		bool bHasEntry = false;
+
+		const bool bSuccess = ReadMessageField(Stream, Tag, [&](FInputStream& EntryStream)
+		{
+			bHasEntry = true;
+			uint32 EntryTag;
+			while ((EntryTag = EntryStream.ReadTag()) != 0)
+			{
+				const int32 FieldNumber = GetTagFieldNumber(EntryTag);
+				const bool bFieldRead = FieldNumber == 1 ? KeyReader(EntryTag, Key)
+					: FieldNumber == 2 ? ValueReader(EntryTag, Value)
+					: SkipField(EntryStream, EntryTag);
+				if (!bFieldRead) return false;
+			}
+			return true;
+		});
+
+		if (bSuccess && bHasEntry)
+		{
+			Out.Add(MoveTemp(Key), MoveTemp(Value));
+		}
+		return bSuccess;
+	}
+
+	static bool ReadFVector(FInputStream& Stream, FVector& Out);
+	static bool ReadFVector3f(FInputStream& Stream, FVector3f& Out);
+	static bool ReadFVectorQuantized(FInputStream& Stream, FVector& Out);
+	static bool ReadFVector2D(FInputStream& Stream, FVector2D& Out);
+	static bool ReadFQuat(FInputStream& Stream, FQuat& Out);
+	static bool ReadFRotator(FInputStream& Stream, FRotator& Out);
+	static bool ReadFQuatCompressed(FInputStream& Stream, FQuat& Out);
+	static bool ReadFRotator3f(FInputStream& Stream, FRotator3f& Out);
+	static bool ReadFRotatorQuantized(FInputStream& Stream, FRotator& Out);
+	static bool ReadFTransform(FInputStream& Stream, FTransform& Out);
+	static bool ReadFColor(FInputStream& Stream, FColor& Out);
+	static bool ReadFLinearColor(FInputStream& Stream, FLinearColor& Out);
+	static bool ReadFGuid(FInputStream& Stream, FGuid& Out);
+	static bool ReadFVector2DArray(FInputStream& Stream, TArray<FVector2D>& Out);
+	static bool ReadFVectorArray(FInputStream& Stream, TArray<FVector>& Out);
+	static bool ReadFQuatArray(FInputStream& Stream, TArray<FQuat>& Out);
+	static bool ReadFTransformArray(FInputStream& Stream, TArray<FTransform>& Out);
+
+private:
+	static bool ReadLength(FInputStream& Stream, int& OutLength)
+	{
+		if (!Stream.ReadVarintSizeAsInt(&OutLength)) return false;
+		const int Remaining = Stream.BytesUntilLimit();
+		return Remaining < 0 || OutLength <= Remaining;
+	}
+};
\ No newline at end of file
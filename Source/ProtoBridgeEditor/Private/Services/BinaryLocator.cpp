@@ -64,6 +64,15 @@ FString FBinaryLocator::FindStandardIncludePath(const FProtoBridgeEnvironmentCon
 	return FString();
 }
 
+FString FBinaryLocator::FindCommonProtoPath(const FProtoBridgeEnvironmentContext& Context)
+{
+	FString ProtoPath = FPaths::Combine(Context.PluginDirectory, FProtoBridgeDefs::CommonProtoFolder);
+	FPaths::NormalizeDirectoryName(ProtoPath);
+	FPaths::CollapseRelativeDirectories(ProtoPath);
+
+	return IFileManager::Get().DirectoryExists(*ProtoPath) ? ProtoPath : FString();
+}
+
 FString FBinaryLocator::FindBinaryPath(const FString& BaseDir, const FString& BinaryName)
 {
 	if (BaseDir.IsEmpty()) return FString();
@@ -9,6 +9,7 @@ public:
 	static FString ResolveProtocPath(const FProtoBridgeEnvironmentContext& Context);
 	static FString ResolvePluginPath(const FProtoBridgeEnvironmentContext& Context);
 	static FString FindStandardIncludePath(const FProtoBridgeEnvironmentContext& Context);
+	static FString FindCommonProtoPath(const FProtoBridgeEnvironmentContext& Context);
 
 private:
 	static FString FindBinaryPath(const FString& BaseDir, const FString& BinaryName);
@@ -42,6 +42,12 @@ bool FCommandBuilder::BuildContent(const FProtoBridgeConfiguration& Config, cons
 		SB << TEXT("--proto_path=") << SafeStandardIncludePath << TEXT("\n");
 	}
 
+	const FString CommonProtoPath = FBinaryLocator::FindCommonProtoPath(Config.Environment);
+	if (!CommonProtoPath.IsEmpty() && !FPaths::IsSamePath(CommonProtoPath, SafeSourceDir))
+	{
+		SB << TEXT("--proto_path=") << CommonProtoPath << TEXT("\n");
+	}
+
 	FString TargetApiMacro = Mapping.ApiMacro.IsEmpty() ? Config.ApiMacro : Mapping.ApiMacro;
 	if (!TargetApiMacro.IsEmpty())
 	{
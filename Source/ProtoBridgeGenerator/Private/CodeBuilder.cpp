@@ -7,6 +7,7 @@ FCodePrinter::FCodePrinter(google::protobuf::io::Printer* InPrinter)
 
 void FCodePrinter::Print(const char* Text)
 {
+	BRIDGE_PROFILE_SCOPE(Printer);
 	Printer->Print(Text);
 }
 
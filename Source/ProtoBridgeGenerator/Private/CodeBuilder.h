@@ -1,5 +1,6 @@
 #pragma once
 
+#include "GeneratorProfiler.h"
 #include <string>
 #include <vector>
 #include <type_traits>
@@ -26,6 +27,7 @@ public:
 	template<typename... Args>
 	void Print(const char* Format, Args&&... args)
 	{
+		BRIDGE_PROFILE_SCOPE(Printer);
 		Printer->Print(Format, std::forward<Args>(args)...);
 	}
 
@@ -21,6 +21,7 @@ namespace UE
 			constexpr const char* FJsonObject = "FJsonObject";
 			constexpr const char* FJsonValue = "FJsonValue";
 			constexpr const char* Uint8 = "uint8";
+			constexpr const char* EProtoWireType = "EProtoWireType";
 		}
 
 		namespace Macros
@@ -59,6 +60,23 @@ namespace UE
 			constexpr const char* Struct = "FProtobufStructUtils";
 			constexpr const char* Reflection = "FProtobufReflectionUtils";
 			constexpr const char* Container = "FProtobufContainerUtils";
+			constexpr const char* Wire = "FProtobufWireUtils";
+			constexpr const char* Delta = "FProtobufDeltaUtils";
+			constexpr const char* FieldMask = "FProtoFieldMask";
+		}
+
+		namespace Metrics
+		{
+			constexpr const char* Site = "FProtoMetricSite";
+			constexpr const char* Scope = "FProtoMetricScope";
+			constexpr const char* Op = "EProtoMetricOp";
+		}
+
+		namespace Memory
+		{
+			constexpr const char* Scope = "LLM_SCOPE_BYTAG";
+			constexpr const char* EncodeTag = "ProtoBridge_Encode";
+			constexpr const char* DecodeTag = "ProtoBridge_Decode";
 		}
 	}
 }
\ No newline at end of file
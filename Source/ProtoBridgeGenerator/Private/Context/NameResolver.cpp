@@ -1,5 +1,6 @@
 ﻿#include "NameResolver.h"
 #include "NameValidator.h"
+#include "../GeneratorProfiler.h"
 #include <algorithm>
 #include <cctype>
 
@@ -16,6 +17,7 @@
 
 std::string FNameResolver::ToPascalCase(const std::string& Input) const
 {
+	BRIDGE_PROFILE_SCOPE(NameResolver);
 	if (Input.empty()) return "";
 	std::string Result;
 	bool bNextUpper = true;
@@ -43,6 +45,7 @@ std::string FNameResolver::ToPascalCase(const std::string& Input) const
 
 std::string FNameResolver::FlattenName(const std::string& FullName) const
 {
+	BRIDGE_PROFILE_SCOPE(NameResolver);
 	std::string Result = FullName;
 	std::replace(Result.begin(), Result.end(), '.', '_');
 	return Result;
@@ -50,6 +53,7 @@ std::string FNameResolver::FlattenName(const std::string& FullName) const
 
 std::string FNameResolver::GetSafeUeName(const std::string& FullName, char Prefix) const
 {
+	BRIDGE_PROFILE_SCOPE(NameResolver);
 	std::string FlatName = FlattenName(FullName);
 	std::string BaseName;
 	
@@ -67,6 +71,7 @@ std::string FNameResolver::GetSafeUeName(const std::string& FullName, char Prefi
 
 std::string FNameResolver::GetProtoCppType(const google::protobuf::Descriptor* Descriptor) const
 {
+	BRIDGE_PROFILE_SCOPE(NameResolver);
 	std::string FullName = std::string(Descriptor->full_name());
 	std::string Result;
 	for (char c : FullName)
@@ -79,6 +84,7 @@ std::string FNameResolver::GetProtoCppType(const google::protobuf::Descriptor* D
 
 std::string FNameResolver::GetProtoCppType(const google::protobuf::EnumDescriptor* Descriptor) const
 {
+	BRIDGE_PROFILE_SCOPE(NameResolver);
 	std::string FullName = std::string(Descriptor->full_name());
 	std::string Result;
 	for (char c : FullName)
@@ -91,6 +97,7 @@ std::string FNameResolver::GetProtoCppType(const google::protobuf::EnumDescripto
 
 std::string FNameResolver::SanitizeTooltip(const std::string& Comment) const
 {
+	BRIDGE_PROFILE_SCOPE(NameResolver);
 	std::string Sanitized;
 	for (char c : Comment)
 	{
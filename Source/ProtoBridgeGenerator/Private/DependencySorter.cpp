@@ -1,4 +1,5 @@
 ﻿#include "DependencySorter.h"
+#include "GeneratorProfiler.h"
 #include <map>
 #include <set>
 #include <stack>
@@ -149,6 +150,7 @@ namespace
 
 std::vector<const google::protobuf::Descriptor*> FDependencySorter::Sort(const google::protobuf::FileDescriptor* File)
 {
+	BRIDGE_PROFILE_SCOPE(DependencySort);
 	std::vector<const google::protobuf::Descriptor*> AllMessages;
 	for (int i = 0; i < File->message_type_count(); ++i)
 	{
@@ -0,0 +1,313 @@
+﻿#ifdef PROTOBUF_USE_DLLS
+#undef PROTOBUF_USE_DLLS
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <google/protobuf/compiler/command_line_interface.h>
+#include "UECodeGenerator.h"
+#include "GeneratorProfiler.h"
+
+namespace
+{
+	struct FSchemaSet
+	{
+		std::vector<std::pair<std::string, std::string>> Files;
+		int MessageCount = 0;
+	};
+
+	struct FScenario
+	{
+		const char* Name;
+		const char* Description;
+		std::function<FSchemaSet()> Build;
+	};
+
+	std::string Header(const std::vector<std::string>& Imports = {})
+	{
+		std::string Text = "syntax = \"proto3\";\n\npackage Bench;\n\n";
+		for (const std::string& Import : Imports)
+		{
+			Text += "import \"" + Import + "\";\n";
+		}
+		return Text + "\n";
+	}
+
+	/** Messages reference later declarations so the sorter has to reorder every file. */
+	FSchemaSet BuildManyMessages(int MessageCount)
+	{
+		std::ostringstream Text;
+		Text << Header();
+		Text << "enum Kind\n{\n  KIND_UNSPECIFIED = 0;\n  KIND_A = 1;\n  KIND_B = 2;\n}\n\n";
+		for (int Index = 0; Index < MessageCount; ++Index)
+		{
+			Text << "message Message" << Index << "\n{\n";
+			Text << "  int32 id = 1;\n  string display_name = 2;\n  repeated float samples = 3;\n";
+			Text << "  map<string, int32> counters = 4;\n  Kind kind = 5;\n  optional int64 revision = 6;\n";
+			if (Index + 1 < MessageCount)
+			{
+				Text << "  Message" << Index + 1 << " next = 7;\n";
+			}
+			if (Index * 2 + 1 < MessageCount)
+			{
+				Text << "  repeated Message" << Index * 2 + 1 << " children = 8;\n";
+			}
+			Text << "}\n\n";
+		}
+		return { { { "many_messages.proto", Text.str() } }, MessageCount };
+	}
+
+	FSchemaSet BuildWideEnums(int EnumCount, int ValueCount, int MessageCount)
+	{
+		std::ostringstream Text;
+		Text << Header();
+		for (int Enum = 0; Enum < EnumCount; ++Enum)
+		{
+			Text << "enum WideEnum" << Enum << "\n{\n";
+			for (int Value = 0; Value < ValueCount; ++Value)
+			{
+				Text << "  WIDE_ENUM" << Enum << "_VALUE_" << Value << " = " << Value << ";\n";
+			}
+			Text << "}\n\n";
+		}
+		for (int Index = 0; Index < MessageCount; ++Index)
+		{
+			Text << "message EnumHolder" << Index << "\n{\n";
+			for (int Field = 0; Field < 10; ++Field)
+			{
+				Text << "  " << (Field % 2 ? "repeated " : "") << "WideEnum" << (Index + Field) % EnumCount << " value_" << Field << " = " << Field + 1 << ";\n";
+			}
+			Text << "}\n\n";
+		}
+		return { { { "wide_enums.proto", Text.str() } }, MessageCount };
+	}
+
+	/** A chain of messages whose oneof members point at the next link. */
+	FSchemaSet BuildDeepOneofs(int Depth, int OneofCount, int MembersPerOneof)
+	{
+		std::ostringstream Text;
+		Text << Header();
+		for (int Index = 0; Index < Depth; ++Index)
+		{
+			Text << "message OneofNode" << Index << "\n{\n";
+			int FieldNumber = 1;
+			for (int Oneof = 0; Oneof < OneofCount; ++Oneof)
+			{
+				Text << "  oneof choice_" << Oneof << "\n  {\n";
+				for (int Member = 0; Member < MembersPerOneof; ++Member)
+				{
+					Text << "    ";
+					if (Member == 0 && Index + 1 < Depth)
+					{
+						Text << "OneofNode" << Index + 1;
+					}
+					else
+					{
+						Text << (Member % 3 == 0 ? "string" : Member % 3 == 1 ? "double" : "int64");
+					}
+					Text << " option_" << Oneof << "_" << Member << " = " << FieldNumber++ << ";\n";
+				}
+				Text << "  }\n";
+			}
+			Text << "}\n\n";
+		}
+		return { { { "deep_oneofs.proto", Text.str() } }, Depth };
+	}
+
+	/** Each file imports up to four earlier files and uses their messages. */
+	FSchemaSet BuildImportGraph(int FileCount, int MessagesPerFile)
+	{
+		FSchemaSet Result;
+		auto FileName = [](int Index) { char Buffer[32]; std::snprintf(Buffer, sizeof(Buffer), "graph_%03d.proto", Index); return std::string(Buffer); };
+
+		for (int File = 0; File < FileCount; ++File)
+		{
+			std::set<int> Imports;
+			for (int Candidate : { File - 1, File / 2, File / 3, File - 7 })
+			{
+				if (Candidate >= 0 && Candidate < File)
+				{
+					Imports.insert(Candidate);
+				}
+			}
+
+			std::vector<std::string> ImportNames;
+			for (int Import : Imports)
+			{
+				ImportNames.push_back(FileName(Import));
+			}
+
+			std::ostringstream Text;
+			Text << Header(ImportNames);
+			for (int Message = 0; Message < MessagesPerFile; ++Message)
+			{
+				Text << "message Graph" << File << "Message" << Message << "\n{\n  int32 id = 1;\n  string label = 2;\n";
+				int FieldNumber = 3;
+				for (int Import : Imports)
+				{
+					Text << "  Graph" << Import << "Message" << Message << " from_" << Import << " = " << FieldNumber++ << ";\n";
+				}
+				Text << "}\n\n";
+			}
+			Result.Files.emplace_back(FileName(File), Text.str());
+			Result.MessageCount += MessagesPerFile;
+		}
+		return Result;
+	}
+
+	const std::vector<FScenario>& GetScenarios()
+	{
+		static const std::vector<FScenario> Scenarios =
+		{
+			{ "messages_1k", "1,000 messages in one file", [] { return BuildManyMessages(1000); } },
+			{ "messages_10k", "10,000 messages in one file", [] { return BuildManyMessages(10000); } },
+			{ "wide_enums", "20 enums x 2,000 values, 200 holder messages", [] { return BuildWideEnums(20, 2000, 200); } },
+			{ "deep_oneofs", "256-deep chain, 4 oneofs x 16 members each", [] { return BuildDeepOneofs(256, 4, 16); } },
+			{ "import_graph", "300 files x 20 messages, up to 4 imports each", [] { return BuildImportGraph(300, 20); } }
+		};
+		return Scenarios;
+	}
+
+	struct FRunResult
+	{
+		double WallMilliseconds = 0.0;
+		std::array<FGeneratorProfiler::FPhaseStats, FGeneratorProfiler::NumPhases> Phases;
+	};
+
+	bool RunGenerator(const std::filesystem::path& SchemaDir, const std::filesystem::path& OutputDir, const std::vector<std::string>& Files, const std::string& Options, FRunResult& OutResult)
+	{
+		FUeCodeGenerator Generator;
+		google::protobuf::compiler::CommandLineInterface Cli;
+		Cli.RegisterGenerator("--ue_out", "--ue_opt", &Generator, "Generate Unreal Engine bindings.");
+
+		std::vector<std::string> Args = { "protoc", "--proto_path=" + SchemaDir.string(), "--ue_out=" + OutputDir.string() };
+		if (!Options.empty())
+		{
+			Args.push_back("--ue_opt=" + Options);
+		}
+		Args.insert(Args.end(), Files.begin(), Files.end());
+
+		std::vector<const char*> Argv;
+		for (const std::string& Arg : Args)
+		{
+			Argv.push_back(Arg.c_str());
+		}
+
+		FGeneratorProfiler::Reset();
+		const auto Start = std::chrono::steady_clock::now();
+		const int ExitCode = Cli.Run(static_cast<int>(Argv.size()), Argv.data());
+		OutResult.WallMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+		OutResult.Phases = FGeneratorProfiler::Snapshot();
+		return ExitCode == 0;
+	}
+
+	void PrintReport(const FScenario& Scenario, const FSchemaSet& Schemas, const FRunResult& Best, int Runs)
+	{
+		std::printf("\n%s: %s (%zu files, %d messages)\n", Scenario.Name, Scenario.Description, Schemas.Files.size(), Schemas.MessageCount);
+		std::printf("  wall %.1f ms, best of %d\n", Best.WallMilliseconds, Runs);
+		std::printf("  %-26s %12s %12s %8s\n", "phase", "calls", "self ms", "share");
+
+		double Attributed = 0.0;
+		for (size_t Index = 0; Index < FGeneratorProfiler::NumPhases; ++Index)
+		{
+			const double SelfMilliseconds = Best.Phases[Index].SelfNanoseconds / 1.0e6;
+			Attributed += SelfMilliseconds;
+			std::printf("  %-26s %12llu %12.1f %7.1f%%\n", FGeneratorProfiler::GetPhaseName(static_cast<EGeneratorPhase>(Index)),
+				static_cast<unsigned long long>(Best.Phases[Index].Calls), SelfMilliseconds, 100.0 * SelfMilliseconds / Best.WallMilliseconds);
+		}
+
+		const double Other = std::max(0.0, Best.WallMilliseconds - Attributed);
+		std::printf("  %-26s %12s %12.1f %7.1f%%\n", "Other (parse, generators)", "", Other, 100.0 * Other / Best.WallMilliseconds);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int Runs = 3;
+	std::string Options;
+	std::set<std::string> Selected;
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const std::string Arg = argv[Index];
+		if (Arg.rfind("--runs=", 0) == 0)
+		{
+			Runs = std::max(1, std::atoi(Arg.c_str() + 7));
+		}
+		else if (Arg.rfind("--options=", 0) == 0)
+		{
+			Options = Arg.substr(10);
+		}
+		else if (Arg == "--help")
+		{
+			std::printf("Usage: bridge_generator_bench [--runs=N] [--options=arena,direct_serialize,...] [scenario...]\nScenarios:");
+			for (const FScenario& Scenario : GetScenarios())
+			{
+				std::printf(" %s", Scenario.Name);
+			}
+			std::printf("\n");
+			return 0;
+		}
+		else
+		{
+			Selected.insert(Arg);
+		}
+	}
+
+	const std::filesystem::path Root = std::filesystem::temp_directory_path() / "bridge_generator_bench";
+	int ExitCode = 0;
+
+	for (const FScenario& Scenario : GetScenarios())
+	{
+		if (!Selected.empty() && !Selected.count(Scenario.Name))
+		{
+			continue;
+		}
+
+		const std::filesystem::path SchemaDir = Root / Scenario.Name / "proto";
+		const std::filesystem::path OutputDir = Root / Scenario.Name / "out";
+		std::filesystem::remove_all(Root / Scenario.Name);
+		std::filesystem::create_directories(SchemaDir);
+		std::filesystem::create_directories(OutputDir);
+
+		const FSchemaSet Schemas = Scenario.Build();
+		std::vector<std::string> Files;
+		for (const auto& [Name, Text] : Schemas.Files)
+		{
+			std::ofstream(SchemaDir / Name, std::ios::binary) << Text;
+			Files.push_back(Name);
+		}
+
+		FRunResult Best;
+		for (int Run = 0; Run < Runs; ++Run)
+		{
+			FRunResult Result;
+			if (!RunGenerator(SchemaDir, OutputDir, Files, Options, Result))
+			{
+				std::fprintf(stderr, "%s: generation failed\n", Scenario.Name);
+				ExitCode = 1;
+				break;
+			}
+			if (Run == 0 || Result.WallMilliseconds < Best.WallMilliseconds)
+			{
+				Best = Result;
+			}
+		}
+
+		if (Best.WallMilliseconds > 0.0)
+		{
+			PrintReport(Scenario, Schemas, Best, Runs);
+		}
+	}
+
+	return ExitCode;
+}
\ No newline at end of file
@@ -1,14 +1,22 @@
 ﻿#include "GeneratorContext.h"
 #include <iostream>
+#include <mutex>
 
-FGeneratorContext::FGeneratorContext(google::protobuf::io::Printer* InPrinter, const std::string& InApiMacro)
+namespace
+{
+	std::mutex LogMutex;
+}
+
+FGeneratorContext::FGeneratorContext(google::protobuf::io::Printer* InPrinter, const FGeneratorOptions& InOptions)
 	: Printer(InPrinter)
-	, ApiMacro(InApiMacro)
+	, ApiMacro(InOptions.ApiMacro.empty() ? "" : InOptions.ApiMacro + " ")
+	, Options(InOptions)
 {
 }
 
 void FGeneratorContext::Log(const std::string& Msg)
 {
+	std::lock_guard<std::mutex> Lock(LogMutex);
 	std::cerr << "[BridgeGenerator] " << Msg << std::endl;
 	std::cerr.flush();
 }
\ No newline at end of file
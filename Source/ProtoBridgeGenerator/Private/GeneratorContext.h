@@ -2,6 +2,7 @@
 
 #include "CodeBuilder.h"
 #include "Context/NameResolver.h"
+#include "GeneratorOptions.h"
 #include <string>
 
 namespace google {
@@ -15,11 +16,12 @@ namespace google {
 class FGeneratorContext
 {
 public:
-	FGeneratorContext(google::protobuf::io::Printer* InPrinter, const std::string& InApiMacro);
+	FGeneratorContext(google::protobuf::io::Printer* InPrinter, const FGeneratorOptions& InOptions);
 
 	FCodePrinter Printer;
 	FNameResolver NameResolver;
 	std::string ApiMacro;
+	FGeneratorOptions Options;
 
 	static void Log(const std::string& Msg);
 };
\ No newline at end of file
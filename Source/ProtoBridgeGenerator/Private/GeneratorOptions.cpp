@@ -0,0 +1,71 @@
+﻿#include "GeneratorOptions.h"
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+	std::string Trim(const std::string& Input)
+	{
+		const size_t First = Input.find_first_not_of(" \t");
+		if (First == std::string::npos) return "";
+		const size_t Last = Input.find_last_not_of(" \t");
+		return Input.substr(First, Last - First + 1);
+	}
+}
+
+FGeneratorOptions FGeneratorOptions::Parse(const std::string& Parameter)
+{
+	FGeneratorOptions Options;
+
+	std::stringstream SS(Parameter);
+	std::string Token;
+	while (std::getline(SS, Token, ','))
+	{
+		Token = Trim(Token);
+		if (Token.empty()) continue;
+
+		if (Token == "arena")
+		{
+			Options.bUseArena = true;
+		}
+		else if (Token == "direct_serialize")
+		{
+			Options.bUseDirectSerialize = true;
+		}
+		else if (Token == "direct_parse")
+		{
+			Options.bUseDirectParse = true;
+		}
+		else if (Token == "dirty_tracking")
+		{
+			Options.bUseDirtyTracking = true;
+		}
+		else if (Token == "metrics")
+		{
+			Options.bUseMetrics = true;
+		}
+		else if (Token == "llm")
+		{
+			Options.bUseMemoryTags = true;
+		}
+		else if (Token.rfind("jobs=", 0) == 0)
+		{
+			const std::string Value = Token.substr(5);
+			if (Value.empty() || Value.find_first_not_of("0123456789") != std::string::npos || Value.size() > 4)
+			{
+				throw std::runtime_error("Invalid generator option '" + Token + "'. Expected jobs=<count>.");
+			}
+			Options.Jobs = std::stoi(Value);
+		}
+		else if (Options.ApiMacro.empty())
+		{
+			Options.ApiMacro = Token;
+		}
+		else
+		{
+			throw std::runtime_error("Unknown generator option '" + Token + "'. API macro is already set to '" + Options.ApiMacro + "'.");
+		}
+	}
+
+	return Options;
+}
\ No newline at end of file
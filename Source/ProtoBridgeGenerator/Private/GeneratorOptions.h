@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string>
+
+struct FGeneratorOptions
+{
+	std::string ApiMacro;
+	bool bUseArena = false;
+	bool bUseDirectSerialize = false;
+	bool bUseDirectParse = false;
+	bool bUseDirtyTracking = false;
+	bool bUseMetrics = false;
+	bool bUseMemoryTags = false;
+	/** Worker threads used by GenerateAll. 0 picks one per hardware thread. */
+	int Jobs = 0;
+
+	static FGeneratorOptions Parse(const std::string& Parameter);
+};
\ No newline at end of file
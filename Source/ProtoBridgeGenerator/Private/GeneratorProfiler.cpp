@@ -0,0 +1,63 @@
+﻿#include "GeneratorProfiler.h"
+
+namespace
+{
+	thread_local FScopedGeneratorTimer* GCurrentTimer = nullptr;
+}
+
+std::array<FGeneratorProfiler::FPhaseCounters, FGeneratorProfiler::NumPhases> FGeneratorProfiler::Counters;
+
+std::array<FGeneratorProfiler::FPhaseStats, FGeneratorProfiler::NumPhases> FGeneratorProfiler::Snapshot()
+{
+	std::array<FPhaseStats, NumPhases> Result;
+	for (size_t Index = 0; Index < NumPhases; ++Index)
+	{
+		Result[Index].Calls = Counters[Index].Calls.load(std::memory_order_relaxed);
+		Result[Index].SelfNanoseconds = Counters[Index].SelfNanoseconds.load(std::memory_order_relaxed);
+	}
+	return Result;
+}
+
+void FGeneratorProfiler::Reset()
+{
+	for (FPhaseCounters& Counter : Counters)
+	{
+		Counter.Calls.store(0, std::memory_order_relaxed);
+		Counter.SelfNanoseconds.store(0, std::memory_order_relaxed);
+	}
+}
+
+const char* FGeneratorProfiler::GetPhaseName(EGeneratorPhase Phase)
+{
+	switch (Phase)
+	{
+	case EGeneratorPhase::DependencySort: return "FDependencySorter::Sort";
+	case EGeneratorPhase::NameResolver: return "FNameResolver";
+	case EGeneratorPhase::TypeRegistry: return "FTypeRegistry::GetInfo";
+	case EGeneratorPhase::Strategies: return "Field strategies";
+	case EGeneratorPhase::Printer: return "FCodePrinter";
+	default: return "Unknown";
+	}
+}
+
+FScopedGeneratorTimer::FScopedGeneratorTimer(EGeneratorPhase InPhase)
+	: Phase(InPhase)
+	, Parent(GCurrentTimer)
+	, Start(std::chrono::steady_clock::now())
+{
+	GCurrentTimer = this;
+}
+
+FScopedGeneratorTimer::~FScopedGeneratorTimer()
+{
+	const int64_t Elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count();
+	GCurrentTimer = Parent;
+	if (Parent)
+	{
+		Parent->ChildNanoseconds += Elapsed;
+	}
+
+	FGeneratorProfiler::FPhaseCounters& Counter = FGeneratorProfiler::Counters[static_cast<size_t>(Phase)];
+	Counter.Calls.fetch_add(1, std::memory_order_relaxed);
+	Counter.SelfNanoseconds.fetch_add(static_cast<uint64_t>(Elapsed - ChildNanoseconds), std::memory_order_relaxed);
+}
\ No newline at end of file
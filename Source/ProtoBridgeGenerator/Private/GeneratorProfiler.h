@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+enum class EGeneratorPhase : uint8_t
+{
+	DependencySort,
+	NameResolver,
+	TypeRegistry,
+	Strategies,
+	Printer,
+	Num
+};
+
+/** Self-time per phase: a nested scope's time is charged to it and removed from its parent. Only active in bridge_generator_bench. */
+class FGeneratorProfiler
+{
+public:
+	static constexpr size_t NumPhases = static_cast<size_t>(EGeneratorPhase::Num);
+
+	struct FPhaseStats
+	{
+		uint64_t Calls = 0;
+		uint64_t SelfNanoseconds = 0;
+	};
+
+	static std::array<FPhaseStats, NumPhases> Snapshot();
+	static void Reset();
+	static const char* GetPhaseName(EGeneratorPhase Phase);
+
+private:
+	friend class FScopedGeneratorTimer;
+
+	struct FPhaseCounters
+	{
+		std::atomic<uint64_t> Calls { 0 };
+		std::atomic<uint64_t> SelfNanoseconds { 0 };
+	};
+
+	static std::array<FPhaseCounters, NumPhases> Counters;
+};
+
+class FScopedGeneratorTimer
+{
+public:
+	explicit FScopedGeneratorTimer(EGeneratorPhase InPhase);
+	~FScopedGeneratorTimer();
+
+	FScopedGeneratorTimer(const FScopedGeneratorTimer&) = delete;
+	FScopedGeneratorTimer& operator=(const FScopedGeneratorTimer&) = delete;
+
+private:
+	EGeneratorPhase Phase;
+	FScopedGeneratorTimer* Parent;
+	std::chrono::steady_clock::time_point Start;
+	int64_t ChildNanoseconds = 0;
+};
+
+#ifdef BRIDGE_GENERATOR_PROFILING
+#define BRIDGE_PROFILE_SCOPE(Phase) FScopedGeneratorTimer GeneratorProfileScope(EGeneratorPhase::Phase)
+#else
+#define BRIDGE_PROFILE_SCOPE(Phase)
+#endif
\ No newline at end of file
@@ -0,0 +1,35 @@
+﻿#include "InstrumentationGenerator.h"
+#include "../GeneratorContext.h"
+#include "../Config/UEDefinitions.h"
+
+void FInstrumentationGenerator::WriteMetricSites(FGeneratorContext& Ctx, const std::string& UeType)
+{
+	if (!Ctx.Options.bUseMetrics) return;
+
+	FScopedBlock NamespaceBlock(Ctx.Printer, "namespace");
+	for (const char* Op : { "ToProto", "FromProto", "Encode", "Decode" })
+	{
+		Ctx.Printer.Print("$site$ $name$(TEXT(\"$type$\"), $op_enum$::$op$);\n", 
+			"site", UE::Names::Metrics::Site, "name", GetMetricSiteName(UeType, Op), "type", UeType, "op_enum", UE::Names::Metrics::Op, "op", Op);
+	}
+}
+
+void FInstrumentationGenerator::WriteScope(FGeneratorContext& Ctx, const std::string& UeType, const std::string& Op, const std::string& BytesArgs)
+{
+	if (Ctx.Options.bUseMemoryTags)
+	{
+		const bool bEncodes = Op == "ToProto" || Op == "Encode";
+		Ctx.Printer.Print("$scope$($tag$);\n", 
+			"scope", UE::Names::Memory::Scope, "tag", bEncodes ? UE::Names::Memory::EncodeTag : UE::Names::Memory::DecodeTag);
+	}
+
+	if (!Ctx.Options.bUseMetrics) return;
+
+	Ctx.Printer.Print("$scope$ MetricScope($name$$args$);\n", 
+		"scope", UE::Names::Metrics::Scope, "name", GetMetricSiteName(UeType, Op), "args", BytesArgs.empty() ? "" : ", " + BytesArgs);
+}
+
+std::string FInstrumentationGenerator::GetMetricSiteName(const std::string& UeType, const std::string& Op)
+{
+	return UeType.substr(1) + Op + "MetricSite";
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include <string>
+
+class FGeneratorContext;
+
+class FInstrumentationGenerator
+{
+public:
+    static void WriteMetricSites(FGeneratorContext& Ctx, const std::string& UeType);
+    /** Opens the LLM tag and metric scope for Op, each only when its generator option is set. */
+    static void WriteScope(FGeneratorContext& Ctx, const std::string& UeType, const std::string& Op, const std::string& BytesArgs = "");
+
+private:
+    static std::string GetMetricSiteName(const std::string& UeType, const std::string& Op);
+};
\ No newline at end of file
@@ -1,10 +1,14 @@
 ﻿#include "MessageGenerator.h"
+#include "InstrumentationGenerator.h"
 #include "../GeneratorContext.h"
 #include "../Config/UEDefinitions.h"
 #include "EnumGenerator.h"
 #include "OneOfGenerator.h"
 #include "../Strategies/FieldStrategyFactory.h"
 #include "../Strategies/FieldStrategy.h"
+#include "../Strategies/StrategyPool.h"
+#include <vector>
+#include <algorithm>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -17,6 +21,39 @@
 #pragma warning(pop)
 #endif
 
+namespace
+{
+	/** Presence bit order shared by deltas and dirty masks: plain fields in declaration order, then one bit per oneof. */
+	struct FPresenceLayout
+	{
+		std::vector<const google::protobuf::FieldDescriptor*> Fields;
+		std::vector<const google::protobuf::OneofDescriptor*> Oneofs;
+
+		size_t GetBitCount() const { return Fields.size() + Oneofs.size(); }
+		std::string GetWordCount() const { return std::to_string(std::max<size_t>((GetBitCount() + 63) / 64, 1)); }
+	};
+
+	FPresenceLayout MakePresenceLayout(const google::protobuf::Descriptor* Message)
+	{
+		FPresenceLayout Layout;
+		for (int i = 0; i < Message->field_count(); ++i)
+		{
+			if (!Message->field(i)->real_containing_oneof())
+			{
+				Layout.Fields.push_back(Message->field(i));
+			}
+		}
+		for (int i = 0; i < Message->oneof_decl_count(); ++i)
+		{
+			if (FOneOfGenerator::IsRealOneof(Message->oneof_decl(i)))
+			{
+				Layout.Oneofs.push_back(Message->oneof_decl(i));
+			}
+		}
+		return Layout;
+	}
+}
+
 void FMessageGenerator::GenerateHeader(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const FStrategyPool& Pool)
 {
 	std::string Name = Ctx.NameResolver.GetSafeUeName(std::string(Message->full_name()), 'F');
@@ -55,6 +92,27 @@ void FMessageGenerator::GenerateHeader(FGeneratorContext& Ctx, const google::pro
 
 	Ctx.Printer.Print("void ToProto($proto$& OutProto) const;\n", "proto", ProtoType);
 	Ctx.Printer.Print("void FromProto(const $proto$& InProto);\n", "proto", ProtoType);
+	Ctx.Printer.Print("void ToProto($proto$& OutProto, const FProtoFieldMask& Mask) const;\n", "proto", ProtoType);
+	Ctx.Printer.Print("void ToProtoMasked($proto$& OutProto, const FProtoFieldMaskNode& Mask) const;\n", "proto", ProtoType);
+	Ctx.Printer.Print("void MergeFromProto(const $proto$& InProto, const FProtoFieldMask& Mask);\n", "proto", ProtoType);
+	Ctx.Printer.Print("void MergeFromProtoMasked(const $proto$& InProto, const FProtoFieldMaskNode& Mask);\n", "proto", ProtoType);
+	Ctx.Printer.Print("bool operator==(const $name$& Other) const;\n", "name", Name);
+	Ctx.Printer.Print("bool operator!=(const $name$& Other) const { return !(*this == Other); }\n", "name", Name);
+	Ctx.Printer.Print("bool ToProtoDelta(const $name$& Baseline, $proto$& OutProto) const;\n", "name", Name, "proto", ProtoType);
+	Ctx.Printer.Print("void ApplyDelta(const $proto$& InProto);\n", "proto", ProtoType);
+	Ctx.Printer.Print("size_t ByteSizeDirect() const;\n");
+	Ctx.Printer.Print("size_t ByteSizeDirect(FProtoDirectSizeCache& SizeCache) const;\n");
+	Ctx.Printer.Print("void SerializeDirectToStream(google::protobuf::io::CodedOutputStream& Stream, FProtoDirectSizeCache& SizeCache) const;\n");
+	Ctx.Printer.Print("bool SerializeDirectToArray($byte$* Target, int32 Size, FProtoDirectSizeCache& SizeCache) const;\n", "byte", UE::Names::Types::Uint8);
+	Ctx.Printer.Print("bool SerializeDirect($arr$<$byte$>& OutBytes) const;\n", "arr", UE::Names::Types::TArray, "byte", UE::Names::Types::Uint8);
+	Ctx.Printer.Print("bool ParseDirectFromStream(google::protobuf::io::CodedInputStream& Stream);\n");
+	Ctx.Printer.Print("bool MergeDirectFromStream(google::protobuf::io::CodedInputStream& Stream);\n");
+	Ctx.Printer.Print("bool ParseDirect(const $byte$* Data, int32 Size);\n", "byte", UE::Names::Types::Uint8);
+
+	if (Ctx.Options.bUseDirtyTracking)
+	{
+		GenerateDirtyTrackingHeader(Ctx, Message, Name, ProtoType, Pool);
+	}
 }
 
 void FMessageGenerator::GenerateSource(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const FStrategyPool& Pool)
@@ -62,8 +120,11 @@ void FMessageGenerator::GenerateSource(FGeneratorContext& Ctx, const google::pro
 	std::string UeType = Ctx.NameResolver.GetSafeUeName(std::string(Message->full_name()), 'F');
 	std::string ProtoType = Ctx.NameResolver.GetProtoCppType(Message);
 
+	FInstrumentationGenerator::WriteMetricSites(Ctx, UeType);
+
 	{
 		FScopedBlock ToProtoBlock(Ctx.Printer, "void " + UeType + "::ToProto(" + ProtoType + "& OutProto) const");
+		FInstrumentationGenerator::WriteScope(Ctx, UeType, "ToProto");
 		
 		for (int i = 0; i < Message->field_count(); ++i)
 		{
@@ -79,6 +140,7 @@ void FMessageGenerator::GenerateSource(FGeneratorContext& Ctx, const google::pro
 
 	{
 		FScopedBlock FromProtoBlock(Ctx.Printer, "void " + UeType + "::FromProto(const " + ProtoType + "& InProto)");
+		FInstrumentationGenerator::WriteScope(Ctx, UeType, "FromProto");
 		
 		for (int i = 0; i < Message->field_count(); ++i)
 		{
@@ -91,4 +153,412 @@ void FMessageGenerator::GenerateSource(FGeneratorContext& Ctx, const google::pro
 
 		FOneOfGenerator::GenerateFromProto(Ctx, Message, UeType, ProtoType, Pool);
 	}
+
+	GenerateFieldMask(Ctx, Message, UeType, ProtoType, Pool);
+	GenerateDelta(Ctx, Message, UeType, ProtoType, Pool);
+	if (Ctx.Options.bUseDirtyTracking)
+	{
+		GenerateDirtyTrackingSource(Ctx, Message, UeType, ProtoType, Pool);
+	}
+	GenerateDirectSerializer(Ctx, Message, UeType, Pool);
+}
+
+void FMessageGenerator::GenerateFieldMask(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool)
+{
+	const FPresenceLayout Layout = MakePresenceLayout(Message);
+	auto IsNestedMessage = [&](const google::protobuf::FieldDescriptor* Field)
+	{
+		return !Field->is_repeated() && FFieldStrategyFactory::GetStrategy(Field, Pool) == Pool.GetMessageStrategy();
+	};
+	auto GetIncludesCondition = [](const google::protobuf::FieldDescriptor* Field)
+	{
+		return "Mask.Includes(" + std::to_string(Field->index()) + ")";
+	};
+	auto GetOneofCondition = [&](const google::protobuf::OneofDescriptor* Oneof)
+	{
+		std::string Condition;
+		for (int j = 0; j < Oneof->field_count(); ++j)
+		{
+			Condition += (j == 0 ? "" : " || ") + GetIncludesCondition(Oneof->field(j));
+		}
+		return Condition;
+	};
+
+	{
+		FScopedBlock ToProtoBlock(Ctx.Printer, "void " + UeType + "::ToProto(" + ProtoType + "& OutProto, const FProtoFieldMask& Mask) const");
+		Ctx.Printer.Print("ToProtoMasked(OutProto, Mask.Compile($proto$::descriptor()));\n", "proto", ProtoType);
+	}
+
+	{
+		FScopedBlock ToProtoBlock(Ctx.Printer, "void " + UeType + "::ToProtoMasked(" + ProtoType + "& OutProto, const FProtoFieldMaskNode& Mask) const");
+		for (const google::protobuf::FieldDescriptor* Field : Layout.Fields)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + GetIncludesCondition(Field) + ")");
+			std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+			auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+			if (!IsNestedMessage(Field))
+			{
+				Strategy->WriteToProto(Ctx, Field, "this->" + Name, std::string(Field->name()));
+				continue;
+			}
+
+			{
+				FScopedBlock ChildBlock(Ctx.Printer, "if (const FProtoFieldMaskNode* Child = Mask.GetChild(" + std::to_string(Field->index()) + "))");
+				Ctx.Printer.Print("this->$name$.ToProtoMasked(*OutProto.mutable_$proto$(), *Child);\n", "name", Name, "proto", std::string(Field->name()));
+			}
+			FScopedBlock ElseBlock(Ctx.Printer, "else");
+			Strategy->WriteToProto(Ctx, Field, "this->" + Name, std::string(Field->name()));
+		}
+		for (const google::protobuf::OneofDescriptor* Oneof : Layout.Oneofs)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + GetOneofCondition(Oneof) + ")");
+			FOneOfGenerator::GenerateOneofToProto(Ctx, Oneof, UeType, Pool);
+		}
+	}
+
+	{
+		FScopedBlock MergeBlock(Ctx.Printer, "void " + UeType + "::MergeFromProto(const " + ProtoType + "& InProto, const FProtoFieldMask& Mask)");
+		Ctx.Printer.Print("MergeFromProtoMasked(InProto, Mask.Compile($proto$::descriptor()));\n", "proto", ProtoType);
+	}
+
+	{
+		FScopedBlock MergeBlock(Ctx.Printer, "void " + UeType + "::MergeFromProtoMasked(const " + ProtoType + "& InProto, const FProtoFieldMaskNode& Mask)");
+		for (const google::protobuf::FieldDescriptor* Field : Layout.Fields)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + GetIncludesCondition(Field) + ")");
+			std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+			auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+			if (!IsNestedMessage(Field))
+			{
+				if (Field->is_repeated())
+				{
+					Ctx.Printer.Print("this->$name$.Reset();\n", "name", Name);
+				}
+				Strategy->WriteFromProto(Ctx, Field, "this->" + Name, std::string(Field->name()));
+				continue;
+			}
+
+			{
+				FScopedBlock ChildBlock(Ctx.Printer, "if (const FProtoFieldMaskNode* Child = Mask.GetChild(" + std::to_string(Field->index()) + "))");
+				Ctx.Printer.Print("this->$name$.MergeFromProtoMasked(InProto.$proto$(), *Child);\n", "name", Name, "proto", std::string(Field->name()));
+			}
+			FScopedBlock ElseBlock(Ctx.Printer, "else");
+			Strategy->WriteFromProto(Ctx, Field, "this->" + Name, std::string(Field->name()));
+		}
+		for (const google::protobuf::OneofDescriptor* Oneof : Layout.Oneofs)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + GetOneofCondition(Oneof) + ")");
+			FOneOfGenerator::GenerateOneofFromProto(Ctx, Oneof, UeType, ProtoType, Pool);
+		}
+	}
+}
+
+void FMessageGenerator::GenerateDelta(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool)
+{
+	const FPresenceLayout Layout = MakePresenceLayout(Message);
+	const std::vector<const google::protobuf::FieldDescriptor*>& Fields = Layout.Fields;
+	const std::vector<const google::protobuf::OneofDescriptor*>& Oneofs = Layout.Oneofs;
+
+	const std::string Delta = UE::Names::Utils::Delta;
+	const std::string NumWords = Layout.GetWordCount();
+	auto GetFieldChanged = [&](const google::protobuf::FieldDescriptor* Field, const std::string& OtherVar)
+	{
+		std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+		return "!" + Delta + "::IsEqual(this->" + Name + ", " + OtherVar + "." + Name + ")";
+	};
+	auto IsNestedMessage = [&](const google::protobuf::FieldDescriptor* Field)
+	{
+		return !Field->is_repeated() && FFieldStrategyFactory::GetStrategy(Field, Pool) == Pool.GetMessageStrategy();
+	};
+
+	{
+		FScopedBlock EqualBlock(Ctx.Printer, "bool " + UeType + "::operator==(const " + UeType + "& Other) const");
+		for (const google::protobuf::FieldDescriptor* Field : Fields)
+		{
+			Ctx.Printer.Print("if ($cond$) return false;\n", "cond", GetFieldChanged(Field, "Other"));
+		}
+		for (const google::protobuf::OneofDescriptor* Oneof : Oneofs)
+		{
+			Ctx.Printer.Print("if ($cond$) return false;\n", "cond", FOneOfGenerator::GetChangedCondition(Ctx, Oneof, UeType, "Other"));
+		}
+		Ctx.Printer.Print("return true;\n");
+	}
+
+	{
+		FScopedBlock DeltaBlock(Ctx.Printer, "bool " + UeType + "::ToProtoDelta(const " + UeType + "& Baseline, " + ProtoType + "& OutProto) const");
+		Ctx.Printer.Print("uint64 Presence[$num$] = {};\n", "num", NumWords);
+
+		int Bit = 0;
+		for (const google::protobuf::FieldDescriptor* Field : Fields)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + GetFieldChanged(Field, "Baseline") + ")");
+			Ctx.Printer.Print("$delta$::SetPresenceBit(Presence, $bit$);\n", "delta", Delta, "bit", std::to_string(Bit++));
+
+			std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+			if (IsNestedMessage(Field))
+			{
+				Ctx.Printer.Print("this->$name$.ToProtoDelta(Baseline.$name$, *OutProto.mutable_$proto$());\n", "name", Name, "proto", std::string(Field->name()));
+			}
+			else
+			{
+				FFieldStrategyFactory::GetStrategy(Field, Pool)->WriteToProto(Ctx, Field, "this->" + Name, std::string(Field->name()));
+			}
+		}
+		for (const google::protobuf::OneofDescriptor* Oneof : Oneofs)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + FOneOfGenerator::GetChangedCondition(Ctx, Oneof, UeType, "Baseline") + ")");
+			Ctx.Printer.Print("$delta$::SetPresenceBit(Presence, $bit$);\n", "delta", Delta, "bit", std::to_string(Bit++));
+			FOneOfGenerator::GenerateOneofToProto(Ctx, Oneof, UeType, Pool);
+		}
+
+		Ctx.Printer.Print("return $delta$::WritePresenceMask(OutProto, Presence, $num$);\n", "delta", Delta, "num", NumWords);
+	}
+
+	{
+		FScopedBlock ApplyBlock(Ctx.Printer, "void " + UeType + "::ApplyDelta(const " + ProtoType + "& InProto)");
+		Ctx.Printer.Print("uint64 Presence[$num$];\n", "num", NumWords);
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (!" + Delta + "::ReadPresenceMask(InProto, Presence, " + NumWords + "))");
+			Ctx.Printer.Print("FromProto(InProto);\n");
+			Ctx.Printer.Print("return;\n");
+		}
+
+		int Bit = 0;
+		for (const google::protobuf::FieldDescriptor* Field : Fields)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + Delta + "::HasPresenceBit(Presence, " + std::to_string(Bit++) + "))");
+
+			std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+			if (IsNestedMessage(Field))
+			{
+				Ctx.Printer.Print("this->$name$.ApplyDelta(InProto.$proto$());\n", "name", Name, "proto", std::string(Field->name()));
+				continue;
+			}
+
+			auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+			if (Field->is_repeated())
+			{
+				Ctx.Printer.Print("this->$name$.Reset();\n", "name", Name);
+			}
+			Strategy->WriteFromProto(Ctx, Field, "this->" + Name, std::string(Field->name()));
+		}
+		for (const google::protobuf::OneofDescriptor* Oneof : Oneofs)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + Delta + "::HasPresenceBit(Presence, " + std::to_string(Bit++) + "))");
+			FOneOfGenerator::GenerateOneofFromProto(Ctx, Oneof, UeType, ProtoType, Pool);
+		}
+	}
+}
+
+void FMessageGenerator::GenerateDirtyTrackingHeader(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool)
+{
+	const FPresenceLayout Layout = MakePresenceLayout(Message);
+	auto PrintSetters = [&](const google::protobuf::FieldDescriptor* Field, size_t Bit, const std::string& Extra)
+	{
+		auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+		std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+		std::string Type = Strategy->GetCppType(Field, Ctx);
+		if (Strategy->IsRepeated(Field))
+		{
+			Type = std::string(UE::Names::Types::TArray) + "<" + Type + ">";
+		}
+
+		bool bByValue = !Field->is_repeated() && Field->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_STRING && Field->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE;
+		std::string Param = bByValue ? Type : "const " + Type + "&";
+		std::string Mark = "DirtyMask[" + std::to_string(Bit / 64) + "] |= 1ull << " + std::to_string(Bit % 64) + ";";
+
+		Ctx.Printer.Print("void Set$name$($param$ InValue) { $name$ = InValue; $extra$$mark$ }\n", "name", Name, "param", Param, "extra", Extra, "mark", Mark);
+		Ctx.Printer.Print("$type$& Mutable$name$() { $extra$$mark$ return $name$; }\n", "type", Type, "name", Name, "extra", Extra, "mark", Mark);
+	};
+
+	Ctx.Printer.Print("\n");
+	size_t Bit = 0;
+	for (const google::protobuf::FieldDescriptor* Field : Layout.Fields)
+	{
+		PrintSetters(Field, Bit++, "");
+	}
+	for (const google::protobuf::OneofDescriptor* Oneof : Layout.Oneofs)
+	{
+		for (int j = 0; j < Oneof->field_count(); ++j)
+		{
+			PrintSetters(Oneof->field(j), Bit, FOneOfGenerator::GetCaseAssignment(Ctx, Oneof->field(j), UeType) + "; ");
+		}
+		++Bit;
+	}
+
+	Ctx.Printer.Print("\nbool IsDirty() const;\n");
+	Ctx.Printer.Print("void MarkAllDirty();\n");
+	Ctx.Printer.Print("void ClearDirty();\n");
+	Ctx.Printer.Print("bool ToProtoDirty($proto$& OutProto) const;\n\n", "proto", ProtoType);
+	Ctx.Printer.Print("uint64 DirtyMask[$num$] = {};\n", "num", Layout.GetWordCount());
+}
+
+void FMessageGenerator::GenerateDirtyTrackingSource(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool)
+{
+	const FPresenceLayout Layout = MakePresenceLayout(Message);
+	const std::string Delta = UE::Names::Utils::Delta;
+	const std::string NumWords = Layout.GetWordCount();
+
+	{
+		FScopedBlock DirtyBlock(Ctx.Printer, "bool " + UeType + "::IsDirty() const");
+		Ctx.Printer.Print("for (uint64 Word : DirtyMask) if (Word != 0) return true;\n");
+		Ctx.Printer.Print("return false;\n");
+	}
+
+	{
+		FScopedBlock MarkBlock(Ctx.Printer, "void " + UeType + "::MarkAllDirty()");
+		Ctx.Printer.Print("for (int32 Bit = 0; Bit < $count$; ++Bit) $delta$::SetPresenceBit(DirtyMask, Bit);\n", "count", std::to_string(Layout.GetBitCount()), "delta", Delta);
+	}
+
+	{
+		FScopedBlock ClearBlock(Ctx.Printer, "void " + UeType + "::ClearDirty()");
+		Ctx.Printer.Print("FMemory::Memzero(DirtyMask, sizeof(DirtyMask));\n");
+	}
+
+	{
+		FScopedBlock ToProtoBlock(Ctx.Printer, "bool " + UeType + "::ToProtoDirty(" + ProtoType + "& OutProto) const");
+
+		int Bit = 0;
+		for (const google::protobuf::FieldDescriptor* Field : Layout.Fields)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + Delta + "::HasPresenceBit(DirtyMask, " + std::to_string(Bit++) + "))");
+			FFieldStrategyFactory::GetStrategy(Field, Pool)->WriteToProto(Ctx, Field, "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name())), std::string(Field->name()));
+		}
+		for (const google::protobuf::OneofDescriptor* Oneof : Layout.Oneofs)
+		{
+			FScopedBlock IfBlock(Ctx.Printer, "if (" + Delta + "::HasPresenceBit(DirtyMask, " + std::to_string(Bit++) + "))");
+			FOneOfGenerator::GenerateOneofToProto(Ctx, Oneof, UeType, Pool);
+		}
+
+		Ctx.Printer.Print("return $delta$::WritePresenceMask(OutProto, DirtyMask, $num$);\n", "delta", Delta, "num", NumWords);
+	}
+}
+
+void FMessageGenerator::GenerateDirectSerializer(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const FStrategyPool& Pool)
+{
+	std::vector<const google::protobuf::FieldDescriptor*> Fields;
+	for (int i = 0; i < Message->field_count(); ++i)
+	{
+		Fields.push_back(Message->field(i));
+	}
+	std::sort(Fields.begin(), Fields.end(), [](const google::protobuf::FieldDescriptor* A, const google::protobuf::FieldDescriptor* B) { return A->number() < B->number(); });
+
+	{
+		FScopedBlock SizeBlock(Ctx.Printer, "size_t " + UeType + "::ByteSizeDirect() const");
+		Ctx.Printer.Print("FProtoDirectSizeCache SizeCache;\n");
+		Ctx.Printer.Print("return ByteSizeDirect(SizeCache);\n");
+	}
+
+	{
+		FScopedBlock SizeBlock(Ctx.Printer, "size_t " + UeType + "::ByteSizeDirect(FProtoDirectSizeCache& SizeCache) const");
+		Ctx.Printer.Print("size_t Size = 0;\n");
+
+		for (const google::protobuf::FieldDescriptor* Field : Fields)
+		{
+			auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+			std::string UeVar = "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+			if (Field->real_containing_oneof())
+			{
+				FScopedBlock IfBlock(Ctx.Printer, "if (" + FOneOfGenerator::GetCaseCondition(Ctx, Field, UeType) + ")");
+				Strategy->WriteByteSize(Ctx, Field, UeVar);
+			}
+			else
+			{
+				Strategy->WriteByteSize(Ctx, Field, UeVar);
+			}
+		}
+
+		Ctx.Printer.Print("return Size;\n");
+	}
+
+	{
+		FScopedBlock WriteBlock(Ctx.Printer, "void " + UeType + "::SerializeDirectToStream(google::protobuf::io::CodedOutputStream& Stream, FProtoDirectSizeCache& SizeCache) const");
+
+		for (const google::protobuf::FieldDescriptor* Field : Fields)
+		{
+			auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+			std::string UeVar = "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+			if (Field->real_containing_oneof())
+			{
+				FScopedBlock IfBlock(Ctx.Printer, "if (" + FOneOfGenerator::GetCaseCondition(Ctx, Field, UeType) + ")");
+				Strategy->WriteSerializeDirect(Ctx, Field, UeVar);
+			}
+			else
+			{
+				Strategy->WriteSerializeDirect(Ctx, Field, UeVar);
+			}
+		}
+	}
+
+	{
+		FScopedBlock SerializeBlock(Ctx.Printer, "bool " + UeType + "::SerializeDirect(" + UE::Names::Types::TArray + "<" + UE::Names::Types::Uint8 + ">& OutBytes) const");
+		Ctx.Printer.Print("FProtoDirectSizeCache SizeCache;\n");
+		Ctx.Printer.Print("const size_t Size = ByteSizeDirect(SizeCache);\n");
+		Ctx.Printer.Print("if (Size > static_cast<size_t>(MAX_int32)) return false;\n\n");
+		Ctx.Printer.Print("OutBytes.SetNumUninitialized(static_cast<int32>(Size));\n");
+		Ctx.Printer.Print("return SerializeDirectToArray(OutBytes.GetData(), static_cast<int32>(Size), SizeCache);\n");
+	}
+
+	{
+		FScopedBlock SerializeBlock(Ctx.Printer, "bool " + UeType + "::SerializeDirectToArray(" + UE::Names::Types::Uint8 + "* Target, int32 Size, FProtoDirectSizeCache& SizeCache) const");
+		Ctx.Printer.Print("google::protobuf::io::ArrayOutputStream Output(Target, Size);\n");
+		Ctx.Printer.Print("google::protobuf::io::CodedOutputStream Stream(&Output);\n");
+		Ctx.Printer.Print("SerializeDirectToStream(Stream, SizeCache);\n");
+		Ctx.Printer.Print("return !Stream.HadError() && Stream.ByteCount() == Size;\n");
+	}
+
+	{
+		FScopedBlock ParseBlock(Ctx.Printer, "bool " + UeType + "::ParseDirectFromStream(google::protobuf::io::CodedInputStream& Stream)");
+
+		for (const google::protobuf::FieldDescriptor* Field : Fields)
+		{
+			auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+			Strategy->WriteParseReset(Ctx, Field, "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
+		}
+		FOneOfGenerator::GenerateParseReset(Ctx, Message, UeType);
+		Ctx.Printer.Print("\nreturn MergeDirectFromStream(Stream);\n");
+	}
+
+	{
+		// Nested message fields merge into what an earlier occurrence of the same field decoded, as MergeFromCodedStream does.
+		FScopedBlock MergeBlock(Ctx.Printer, "bool " + UeType + "::MergeDirectFromStream(google::protobuf::io::CodedInputStream& Stream)");
+		Ctx.Printer.Print("uint32 Tag;\n");
+		{
+			FScopedBlock Loop(Ctx.Printer, "while ((Tag = Stream.ReadTag()) != 0)");
+			FScopedSwitch Switch(Ctx.Printer, std::string(UE::Names::Utils::Wire) + "::GetTagFieldNumber(Tag)");
+
+			for (const google::protobuf::FieldDescriptor* Field : Fields)
+			{
+				Ctx.Printer.Print("case $num$:\n", "num", std::to_string(Field->number()));
+				FScopedBlock CaseBlock(Ctx.Printer);
+				auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+				if (Field->real_containing_oneof())
+				{
+					// Switching the active member starts a message member afresh instead of merging into an earlier occurrence.
+					if (Field->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+					{
+						FScopedBlock ResetBlock(Ctx.Printer, "if (!(" + FOneOfGenerator::GetCaseCondition(Ctx, Field, UeType) + "))");
+						Strategy->WriteParseReset(Ctx, Field, "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
+					}
+					Ctx.Printer.Print("$assign$;\n", "assign", FOneOfGenerator::GetCaseAssignment(Ctx, Field, UeType));
+				}
+
+				Strategy->WriteParseDirect(Ctx, Field, "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
+				Ctx.Printer.Print("break;\n");
+			}
+
+			Ctx.Printer.Print("default:\n");
+			FScopedBlock DefaultBlock(Ctx.Printer);
+			Ctx.Printer.Print("if (!$utils$::SkipField(Stream, Tag)) return false;\n", "utils", UE::Names::Utils::Wire);
+			Ctx.Printer.Print("break;\n");
+		}
+		Ctx.Printer.Print("return Stream.ConsumedEntireMessage();\n");
+	}
+
+	{
+		FScopedBlock ParseBlock(Ctx.Printer, "bool " + UeType + "::ParseDirect(const " + UE::Names::Types::Uint8 + "* Data, int32 Size)");
+		Ctx.Printer.Print("if (Size < 0 || (Size > 0 && !Data)) return false;\n\n");
+		Ctx.Printer.Print("google::protobuf::io::CodedInputStream Stream(Data, Size);\n");
+		Ctx.Printer.Print("return ParseDirectFromStream(Stream);\n");
+	}
 }
\ No newline at end of file
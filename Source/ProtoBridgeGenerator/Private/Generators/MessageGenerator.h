@@ -1,4 +1,5 @@
 #pragma once
+#include <string>
 
 class FGeneratorContext;
 class FStrategyPool;
@@ -13,4 +14,11 @@ class FMessageGenerator
 public:
     static void GenerateHeader(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const FStrategyPool& Pool);
     static void GenerateSource(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const FStrategyPool& Pool);
+
+private:
+    static void GenerateDirtyTrackingHeader(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool);
+    static void GenerateDirtyTrackingSource(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool);
+    static void GenerateFieldMask(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool);
+    static void GenerateDelta(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool);
+    static void GenerateDirectSerializer(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const FStrategyPool& Pool);
 };
\ No newline at end of file
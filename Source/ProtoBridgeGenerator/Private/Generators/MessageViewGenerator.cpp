@@ -0,0 +1,158 @@
+﻿#include "MessageViewGenerator.h"
+#include "../GeneratorContext.h"
+#include "../Config/UEDefinitions.h"
+#include "../Strategies/FieldStrategyFactory.h"
+#include "../Strategies/FieldStrategy.h"
+#include <algorithm>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4800 4125 4668 4541 4946)
+#endif
+
+#include <google/protobuf/descriptor.h>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+void FMessageViewGenerator::GenerateHeader(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const FStrategyPool& Pool)
+{
+	std::string UeType = Ctx.NameResolver.GetSafeUeName(std::string(Message->full_name()), 'F');
+	std::string ViewName = GetViewName(Ctx, Message);
+	std::string Byte = UE::Names::Types::Uint8;
+	std::string ByteArray = std::string(UE::Names::Types::TArray) + "<" + Byte + ">";
+
+	Ctx.Printer.Print("/** Lazily decoded $type$ wire bytes. A field offset index is built on first access and fields are decoded on demand. Not thread-safe. */\n", "type", UeType);
+	FScopedClass ViewBlock(Ctx.Printer, "class " + Ctx.ApiMacro + ViewName);
+
+	Ctx.Printer.Print("public:\n");
+	Ctx.Printer.Print("$view$() = default;\n", "view", ViewName);
+	Ctx.Printer.Print("explicit $view$($arr$ InBytes) : Bytes(MoveTemp(InBytes)) {}\n", "view", ViewName, "arr", ByteArray);
+	Ctx.Printer.Print("explicit $view$(FMemoryView InView) : Bytes(static_cast<const $byte$*>(InView.GetData()), static_cast<int32>(InView.GetSize())) {}\n\n", "view", ViewName, "byte", Byte);
+
+	Ctx.Printer.Print("FMemoryView GetBytes() const { return FMemoryView(Bytes.GetData(), Bytes.Num()); }\n");
+	Ctx.Printer.Print("bool IsValid() const { return EnsureIndex(); }\n");
+	Ctx.Printer.Print("bool Materialize($type$& OutStruct) const;\n\n", "type", UeType);
+
+	for (int i = 0; i < Message->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* Field = Message->field(i);
+		std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+		Ctx.Printer.Print("bool Has$name$() const { return EnsureIndex() && Spans[$index$].Begin >= 0; }\n", "name", Name, "index", std::to_string(i));
+		Ctx.Printer.Print("bool Get$name$($type$& OutValue) const;\n", "name", Name, "type", GetFieldType(Ctx, Field, Pool));
+	}
+
+	Ctx.Printer.Print("\nprivate:\n");
+	Ctx.Printer.Print("struct FFieldSpan { int32 Begin = -1; int32 End = -1; };\n\n");
+	Ctx.Printer.Print("bool EnsureIndex() const;\n\n");
+	Ctx.Printer.Print("$arr$ Bytes;\n", "arr", ByteArray);
+	Ctx.Printer.Print("mutable FFieldSpan Spans[$num$];\n", "num", std::to_string(std::max(Message->field_count(), 1)));
+	Ctx.Printer.Print("mutable int8 IndexState = 0;\n");
+
+	const int OneofCount = Message->real_oneof_decl_count();
+	if (OneofCount > 0)
+	{
+		std::string Initializer;
+		for (int i = 0; i < OneofCount; ++i)
+		{
+			Initializer += (i > 0 ? ", " : "") + std::string("INDEX_NONE");
+		}
+		Ctx.Printer.Print("\n/** Slot of the last member seen per oneof. Spans of members it displaced are cleared, matching ParseDirect. */\n");
+		Ctx.Printer.Print("mutable int32 ActiveOneofSlots[$num$] = { $init$ };\n", "num", std::to_string(OneofCount), "init", Initializer);
+		FScopedBlock SelectBlock(Ctx.Printer, "void SelectOneofMember(int32 Oneof, int32 Slot) const");
+		Ctx.Printer.Print("if (ActiveOneofSlots[Oneof] == Slot) return;\n");
+		Ctx.Printer.Print("if (ActiveOneofSlots[Oneof] != INDEX_NONE) Spans[ActiveOneofSlots[Oneof]] = FFieldSpan();\n");
+		Ctx.Printer.Print("ActiveOneofSlots[Oneof] = Slot;\n");
+	}
+}
+
+void FMessageViewGenerator::GenerateSource(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const FStrategyPool& Pool)
+{
+	std::string UeType = Ctx.NameResolver.GetSafeUeName(std::string(Message->full_name()), 'F');
+	std::string ViewName = GetViewName(Ctx, Message);
+	std::string Wire = UE::Names::Utils::Wire;
+
+	{
+		FScopedBlock MaterializeBlock(Ctx.Printer, "bool " + ViewName + "::Materialize(" + UeType + "& OutStruct) const");
+		Ctx.Printer.Print("return OutStruct.ParseDirect(Bytes.GetData(), Bytes.Num());\n");
+	}
+
+	{
+		FScopedBlock IndexBlock(Ctx.Printer, "bool " + ViewName + "::EnsureIndex() const");
+		Ctx.Printer.Print("if (IndexState != 0) return IndexState > 0;\n");
+		Ctx.Printer.Print("IndexState = -1;\n\n");
+		Ctx.Printer.Print("google::protobuf::io::CodedInputStream Stream(Bytes.GetData(), Bytes.Num());\n");
+		{
+			FScopedBlock Loop(Ctx.Printer, "while (true)");
+			Ctx.Printer.Print("const int32 Begin = Stream.CurrentPosition();\n");
+			Ctx.Printer.Print("const uint32 Tag = Stream.ReadTag();\n");
+			Ctx.Printer.Print("if (Tag == 0) break;\n");
+			Ctx.Printer.Print("if (!$utils$::SkipField(Stream, Tag)) return false;\n\n", "utils", Wire);
+
+			Ctx.Printer.Print("int32 Slot = INDEX_NONE;\n");
+			{
+				FScopedSwitch Switch(Ctx.Printer, Wire + "::GetTagFieldNumber(Tag)");
+				for (int i = 0; i < Message->field_count(); ++i)
+				{
+					const google::protobuf::FieldDescriptor* Field = Message->field(i);
+					if (const google::protobuf::OneofDescriptor* Oneof = Field->real_containing_oneof())
+					{
+						Ctx.Printer.Print("case $num$: Slot = $index$; SelectOneofMember($oneof$, Slot); break;\n", "num", std::to_string(Field->number()), "index", std::to_string(i), "oneof", std::to_string(Oneof->index()));
+					}
+					else
+					{
+						Ctx.Printer.Print("case $num$: Slot = $index$; break;\n", "num", std::to_string(Field->number()), "index", std::to_string(i));
+					}
+				}
+				Ctx.Printer.Print("default: continue;\n");
+			}
+
+			Ctx.Printer.Print("if (Spans[Slot].Begin < 0) Spans[Slot].Begin = Begin;\n");
+			Ctx.Printer.Print("Spans[Slot].End = Stream.CurrentPosition();\n");
+		}
+		Ctx.Printer.Print("if (!Stream.ConsumedEntireMessage()) return false;\n\n");
+		Ctx.Printer.Print("IndexState = 1;\n");
+		Ctx.Printer.Print("return true;\n");
+	}
+
+	for (int i = 0; i < Message->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* Field = Message->field(i);
+		std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+		std::string Index = std::to_string(i);
+
+		FScopedBlock GetBlock(Ctx.Printer, "bool " + ViewName + "::Get" + Name + "(" + GetFieldType(Ctx, Field, Pool) + "& OutValue) const");
+		Ctx.Printer.Print(Field->is_repeated() ? "OutValue.Reset();\n" : "OutValue = {};\n");
+		Ctx.Printer.Print("if (!EnsureIndex()) return false;\n");
+		Ctx.Printer.Print("if (Spans[$index$].Begin < 0) return true;\n\n", "index", Index);
+		Ctx.Printer.Print("google::protobuf::io::CodedInputStream Stream(Bytes.GetData() + Spans[$index$].Begin, Spans[$index$].End - Spans[$index$].Begin);\n", "index", Index);
+		Ctx.Printer.Print("uint32 Tag;\n");
+		{
+			FScopedBlock Loop(Ctx.Printer, "while ((Tag = Stream.ReadTag()) != 0)");
+			{
+				FScopedBlock SkipBlock(Ctx.Printer, "if (" + Wire + "::GetTagFieldNumber(Tag) != " + std::to_string(Field->number()) + ")");
+				Ctx.Printer.Print("if (!$utils$::SkipField(Stream, Tag)) return false;\n", "utils", Wire);
+				Ctx.Printer.Print("continue;\n");
+			}
+			FFieldStrategyFactory::GetStrategy(Field, Pool)->WriteParseDirect(Ctx, Field, "OutValue");
+		}
+		Ctx.Printer.Print("return true;\n");
+	}
+}
+
+std::string FMessageViewGenerator::GetViewName(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message)
+{
+	return Ctx.NameResolver.GetSafeUeName(std::string(Message->full_name()), 'F') + "View";
+}
+
+std::string FMessageViewGenerator::GetFieldType(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const FStrategyPool& Pool)
+{
+	auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+	std::string Type = Strategy->GetCppType(Field, Ctx);
+	if (Strategy->IsRepeated(Field))
+	{
+		Type = std::string(UE::Names::Types::TArray) + "<" + Type + ">";
+	}
+	return Type;
+}
\ No newline at end of file
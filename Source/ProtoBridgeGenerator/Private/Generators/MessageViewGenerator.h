@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+
+class FGeneratorContext;
+class FStrategyPool;
+namespace google {
+    namespace protobuf {
+        class Descriptor;
+        class FieldDescriptor;
+    }
+}
+
+class FMessageViewGenerator
+{
+public:
+    static void GenerateHeader(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const FStrategyPool& Pool);
+    static void GenerateSource(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const FStrategyPool& Pool);
+
+private:
+    static std::string GetViewName(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message);
+    static std::string GetFieldType(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const FStrategyPool& Pool);
+};
\ No newline at end of file
@@ -20,7 +20,7 @@ void FOneOfGenerator::GenerateEnums(FGeneratorContext& Ctx, const google::protob
 	for (int i = 0; i < Message->oneof_decl_count(); ++i)
 	{
 		const google::protobuf::OneofDescriptor* Oneof = Message->oneof_decl(i);
-		if (Oneof->field_count() == 0 || Oneof->field(0)->real_containing_oneof() != Oneof) continue; 
+		if (!IsRealOneof(Oneof)) continue;
 
 		std::string EnumName = GetOneOfEnumName(Ctx, Oneof, StructName);
 		
@@ -40,7 +40,7 @@ void FOneOfGenerator::GenerateProperties(FGeneratorContext& Ctx, const google::p
 	for (int i = 0; i < Message->oneof_decl_count(); ++i)
 	{
 		const google::protobuf::OneofDescriptor* Oneof = Message->oneof_decl(i);
-		if (Oneof->field_count() == 0 || Oneof->field(0)->real_containing_oneof() != Oneof) continue;
+		if (!IsRealOneof(Oneof)) continue;
 
 		std::string EnumName = GetOneOfEnumName(Ctx, Oneof, StructName);
 		std::string PropName = Ctx.NameResolver.ToPascalCase(std::string(Oneof->name())) + "Case";
@@ -55,25 +55,9 @@ void FOneOfGenerator::GenerateToProto(FGeneratorContext& Ctx, const google::prot
 	for(int i=0; i < Message->oneof_decl_count(); ++i)
 	{
 		const google::protobuf::OneofDescriptor* Oneof = Message->oneof_decl(i);
-		if (Oneof->field_count() == 0 || Oneof->field(0)->real_containing_oneof() != Oneof) continue;
+		if (!IsRealOneof(Oneof)) continue;
 
-		std::string CaseProp = Ctx.NameResolver.ToPascalCase(std::string(Oneof->name())) + "Case";
-		std::string EnumName = GetOneOfEnumName(Ctx, Oneof, UeType);
-		
-		FScopedSwitch Switch(Ctx.Printer, CaseProp);
-		
-		for(int j=0; j < Oneof->field_count(); ++j)
-		{
-			const google::protobuf::FieldDescriptor* Field = Oneof->field(j);
-			Ctx.Printer.Print("case $enum$::$name$:\n", "enum", EnumName, "name", Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
-			{
-				FScopedBlock CaseBlock(Ctx.Printer);
-				auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
-				Strategy->WriteToProto(Ctx, Field, "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name())), std::string(Field->name()));
-				Ctx.Printer.Print("break;\n");
-			}
-		}
-		Ctx.Printer.Print("default: break;\n");
+		GenerateOneofToProto(Ctx, Oneof, UeType, Pool);
 	}
 }
 
@@ -82,33 +66,106 @@ void FOneOfGenerator::GenerateFromProto(FGeneratorContext& Ctx, const google::pr
 	for(int i=0; i < Message->oneof_decl_count(); ++i)
 	{
 		const google::protobuf::OneofDescriptor* Oneof = Message->oneof_decl(i);
-		if (Oneof->field_count() == 0 || Oneof->field(0)->real_containing_oneof() != Oneof) continue;
-
-		std::string CaseProp = Ctx.NameResolver.ToPascalCase(std::string(Oneof->name())) + "Case";
-		std::string EnumName = GetOneOfEnumName(Ctx, Oneof, UeType);
+		if (!IsRealOneof(Oneof)) continue;
 
-		FScopedSwitch Switch(Ctx.Printer, "InProto." + std::string(Oneof->name()) + "_case()");
+		GenerateOneofFromProto(Ctx, Oneof, UeType, ProtoType, Pool);
+	}
+}
 
-		for(int j=0; j < Oneof->field_count(); ++j)
+void FOneOfGenerator::GenerateOneofToProto(FGeneratorContext& Ctx, const google::protobuf::OneofDescriptor* Oneof, const std::string& UeType, const FStrategyPool& Pool)
+{
+	std::string CaseProp = Ctx.NameResolver.ToPascalCase(std::string(Oneof->name())) + "Case";
+	std::string EnumName = GetOneOfEnumName(Ctx, Oneof, UeType);
+	
+	FScopedSwitch Switch(Ctx.Printer, CaseProp);
+	
+	for(int j=0; j < Oneof->field_count(); ++j)
+	{
+		const google::protobuf::FieldDescriptor* Field = Oneof->field(j);
+		Ctx.Printer.Print("case $enum$::$name$:\n", "enum", EnumName, "name", Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
 		{
-			const google::protobuf::FieldDescriptor* Field = Oneof->field(j);
-			Ctx.Printer.Print("case $proto$::k$name$:\n", "proto", ProtoType, "name", Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
-			{
-				FScopedBlock CaseBlock(Ctx.Printer);
-				Ctx.Printer.Print("$prop$ = $enum$::$name$;\n", "prop", CaseProp, "enum", EnumName, "name", Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
-				
-				auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
-				Strategy->WriteFromProto(Ctx, Field, "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name())), std::string(Field->name()));
-				Ctx.Printer.Print("break;\n");
-			}
+			FScopedBlock CaseBlock(Ctx.Printer);
+			auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+			Strategy->WriteToProto(Ctx, Field, "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name())), std::string(Field->name()));
+			Ctx.Printer.Print("break;\n");
 		}
-		Ctx.Printer.Print("default:\n");
+	}
+	Ctx.Printer.Print("default: break;\n");
+}
+
+void FOneOfGenerator::GenerateOneofFromProto(FGeneratorContext& Ctx, const google::protobuf::OneofDescriptor* Oneof, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool)
+{
+	std::string CaseProp = Ctx.NameResolver.ToPascalCase(std::string(Oneof->name())) + "Case";
+	std::string EnumName = GetOneOfEnumName(Ctx, Oneof, UeType);
+
+	FScopedSwitch Switch(Ctx.Printer, "InProto." + std::string(Oneof->name()) + "_case()");
+
+	for(int j=0; j < Oneof->field_count(); ++j)
+	{
+		const google::protobuf::FieldDescriptor* Field = Oneof->field(j);
+		Ctx.Printer.Print("case $proto$::k$name$:\n", "proto", ProtoType, "name", Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
 		{
-			FScopedBlock DefaultBlock(Ctx.Printer);
-			Ctx.Printer.Print("$prop$ = $enum$::None;\n", "prop", CaseProp, "enum", EnumName);
+			FScopedBlock CaseBlock(Ctx.Printer);
+			Ctx.Printer.Print("$prop$ = $enum$::$name$;\n", "prop", CaseProp, "enum", EnumName, "name", Ctx.NameResolver.ToPascalCase(std::string(Field->name())));
+			
+			auto Strategy = FFieldStrategyFactory::GetStrategy(Field, Pool);
+			Strategy->WriteFromProto(Ctx, Field, "this->" + Ctx.NameResolver.ToPascalCase(std::string(Field->name())), std::string(Field->name()));
 			Ctx.Printer.Print("break;\n");
 		}
 	}
+	Ctx.Printer.Print("default:\n");
+	{
+		FScopedBlock DefaultBlock(Ctx.Printer);
+		Ctx.Printer.Print("$prop$ = $enum$::None;\n", "prop", CaseProp, "enum", EnumName);
+		Ctx.Printer.Print("break;\n");
+	}
+}
+
+std::string FOneOfGenerator::GetChangedCondition(FGeneratorContext& Ctx, const google::protobuf::OneofDescriptor* Oneof, const std::string& UeType, const std::string& OtherVar)
+{
+	std::string CaseProp = Ctx.NameResolver.ToPascalCase(std::string(Oneof->name())) + "Case";
+	std::string Condition = "this->" + CaseProp + " != " + OtherVar + "." + CaseProp;
+	for (int j = 0; j < Oneof->field_count(); ++j)
+	{
+		const google::protobuf::FieldDescriptor* Field = Oneof->field(j);
+		std::string Name = Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
+		Condition += " || (" + GetCaseCondition(Ctx, Field, UeType) + " && !" + UE::Names::Utils::Delta + "::IsEqual(this->" + Name + ", " + OtherVar + "." + Name + "))";
+	}
+	return Condition;
+}
+
+bool FOneOfGenerator::IsRealOneof(const google::protobuf::OneofDescriptor* Oneof)
+{
+	return Oneof->field_count() > 0 && Oneof->field(0)->real_containing_oneof() == Oneof;
+}
+
+void FOneOfGenerator::GenerateParseReset(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType)
+{
+	for (int i = 0; i < Message->oneof_decl_count(); ++i)
+	{
+		const google::protobuf::OneofDescriptor* Oneof = Message->oneof_decl(i);
+		if (!IsRealOneof(Oneof)) continue;
+
+		std::string CaseProp = Ctx.NameResolver.ToPascalCase(std::string(Oneof->name())) + "Case";
+		Ctx.Printer.Print("this->$prop$ = $enum$::None;\n", "prop", CaseProp, "enum", GetOneOfEnumName(Ctx, Oneof, UeType));
+	}
+}
+
+std::string FOneOfGenerator::GetCaseCondition(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& StructName)
+{
+	std::string CaseProp = Ctx.NameResolver.ToPascalCase(std::string(Field->real_containing_oneof()->name())) + "Case";
+	return "this->" + CaseProp + " == " + GetCaseValue(Ctx, Field, StructName);
+}
+
+std::string FOneOfGenerator::GetCaseAssignment(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& StructName)
+{
+	std::string CaseProp = Ctx.NameResolver.ToPascalCase(std::string(Field->real_containing_oneof()->name())) + "Case";
+	return "this->" + CaseProp + " = " + GetCaseValue(Ctx, Field, StructName);
+}
+
+std::string FOneOfGenerator::GetCaseValue(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& StructName)
+{
+	return GetOneOfEnumName(Ctx, Field->real_containing_oneof(), StructName) + "::" + Ctx.NameResolver.ToPascalCase(std::string(Field->name()));
 }
 
 std::string FOneOfGenerator::GetOneOfEnumName(FGeneratorContext& Ctx, const google::protobuf::OneofDescriptor* Oneof, const std::string& StructName)
@@ -7,6 +7,7 @@ namespace google {
     namespace protobuf {
         class Descriptor;
         class OneofDescriptor;
+        class FieldDescriptor;
     }
 }
 
@@ -17,7 +18,15 @@ public:
     static void GenerateProperties(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& StructName);
     static void GenerateToProto(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const FStrategyPool& Pool);
     static void GenerateFromProto(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool);
+    static void GenerateOneofToProto(FGeneratorContext& Ctx, const google::protobuf::OneofDescriptor* Oneof, const std::string& UeType, const FStrategyPool& Pool);
+    static void GenerateOneofFromProto(FGeneratorContext& Ctx, const google::protobuf::OneofDescriptor* Oneof, const std::string& UeType, const std::string& ProtoType, const FStrategyPool& Pool);
+    static std::string GetChangedCondition(FGeneratorContext& Ctx, const google::protobuf::OneofDescriptor* Oneof, const std::string& UeType, const std::string& OtherVar);
+    static bool IsRealOneof(const google::protobuf::OneofDescriptor* Oneof);
+    static std::string GetCaseCondition(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& StructName);
+    static std::string GetCaseAssignment(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& StructName);
+    static void GenerateParseReset(FGeneratorContext& Ctx, const google::protobuf::Descriptor* Message, const std::string& UeType);
 
 private:
+    static std::string GetCaseValue(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& StructName);
     static std::string GetOneOfEnumName(FGeneratorContext& Ctx, const google::protobuf::OneofDescriptor* Oneof, const std::string& StructName);
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿#include "ProtoLibraryGenerator.h"
+#include "InstrumentationGenerator.h"
 #include "../GeneratorContext.h"
 #include "../Config/UEDefinitions.h"
 
@@ -32,8 +33,27 @@ void FProtoLibraryGenerator::GenerateHeader(FGeneratorContext& Ctx, const std::s
 
 		Ctx.Printer.Print("$macro$($bp$, $cat$=\"Protobuf|$base$\")\n", 
 			"macro", UE::Names::Macros::UFUNCTION, "bp", UE::Names::Specifiers::BlueprintCallable, "cat", UE::Names::Specifiers::Category, "base", BaseName);
-		Ctx.Printer.Print("static bool Decode$func$(const $arr$<uint8>& InBytes, $type$& OutStruct);\n\n", 
+		Ctx.Printer.Print("static bool Decode$func$(const $arr$<uint8>& InBytes, $type$& OutStruct);\n", 
 			"func", FuncNameSuffix, "type", UeType, "arr", UE::Names::Types::TArray);
+		Ctx.Printer.Print("static bool Decode$func$(FMemoryView InView, $type$& OutStruct);\n", "func", FuncNameSuffix, "type", UeType);
+		Ctx.Printer.Print("static bool Decode$func$(TArrayView<const uint8> InBytes, $type$& OutStruct);\n", "func", FuncNameSuffix, "type", UeType);
+		Ctx.Printer.Print("static bool Decode$func$(FArchive& Ar, int64 Length, $type$& OutStruct);\n\n", "func", FuncNameSuffix, "type", UeType);
+
+		Ctx.Printer.Print("static bool EncodeAppend(const $type$& InStruct, $arr$<uint8>& Buffer);\n", "type", UeType, "arr", UE::Names::Types::TArray);
+		Ctx.Printer.Print("static int32 EncodeInto(const $type$& InStruct, TArrayView<uint8> OutBuffer);\n\n", "type", UeType);
+
+		Ctx.Printer.Print("$macro$($bp$, $cat$=\"Protobuf|$base$\")\n", 
+			"macro", UE::Names::Macros::UFUNCTION, "bp", UE::Names::Specifiers::BlueprintCallable, "cat", UE::Names::Specifiers::Category, "base", BaseName);
+		Ctx.Printer.Print("static bool Encode$func$Batch(const $arr$<$type$>& InStructs, $arr$<uint8>& OutBytes);\n\n", 
+			"func", FuncNameSuffix, "type", UeType, "arr", UE::Names::Types::TArray);
+
+		Ctx.Printer.Print("$macro$($bp$, $cat$=\"Protobuf|$base$\")\n", 
+			"macro", UE::Names::Macros::UFUNCTION, "bp", UE::Names::Specifiers::BlueprintCallable, "cat", UE::Names::Specifiers::Category, "base", BaseName);
+		Ctx.Printer.Print("static bool Decode$func$Batch(const $arr$<uint8>& InBytes, $arr$<$type$>& OutStructs);\n\n", 
+			"func", FuncNameSuffix, "type", UeType, "arr", UE::Names::Types::TArray);
+
+		Ctx.Printer.Print("static bool EncodeBatch(TConstArrayView<$type$> InStructs, $arr$<uint8>& Buffer);\n", "type", UeType, "arr", UE::Names::Types::TArray);
+		Ctx.Printer.Print("static bool DecodeBatch(FMemoryView InView, $arr$<$type$>& OutStructs);\n\n", "type", UeType, "arr", UE::Names::Types::TArray);
 	}
 }
 
@@ -48,25 +68,243 @@ void FProtoLibraryGenerator::GenerateSource(FGeneratorContext& Ctx, const std::s
 		{
 			FScopedBlock EncodeBlock(Ctx.Printer, 
 				"bool U" + BaseName + "ProtoLibrary::Encode" + FuncNameSuffix + "(const " + UeType + "& InStruct, " + UE::Names::Types::TArray + "<uint8>& OutBytes)");
-			Ctx.Printer.Print("$proto$ Proto;\n", "proto", ProtoType);
-			Ctx.Printer.Print("InStruct.ToProto(Proto);\n");
-			Ctx.Printer.Print("int32 Size = Proto.ByteSizeLong();\n");
-			Ctx.Printer.Print("OutBytes.SetNumUninitialized(Size);\n");
-			Ctx.Printer.Print("return Proto.SerializeToArray(OutBytes.GetData(), Size);\n");
+			FInstrumentationGenerator::WriteScope(Ctx, UeType, "Encode", "OutBytes, false");
+			if (Ctx.Options.bUseDirectSerialize)
+			{
+				Ctx.Printer.Print("return InStruct.SerializeDirect(OutBytes);\n");
+			}
+			else
+			{
+				WriteProtoInstance(Ctx, ProtoType);
+				Ctx.Printer.Print("InStruct.ToProto(Proto);\n");
+				Ctx.Printer.Print("int32 Size = Proto.ByteSizeLong();\n");
+				Ctx.Printer.Print("OutBytes.SetNumUninitialized(Size);\n");
+				Ctx.Printer.Print("return Proto.SerializeToArray(OutBytes.GetData(), Size);\n");
+			}
 		}
 
 		{
 			FScopedBlock DecodeBlock(Ctx.Printer, 
 				"bool U" + BaseName + "ProtoLibrary::Decode" + FuncNameSuffix + "(const " + UE::Names::Types::TArray + "<uint8>& InBytes, " + UeType + "& OutStruct)");
-			Ctx.Printer.Print("$proto$ Proto;\n", "proto", ProtoType);
-			
-			Ctx.Printer.Print("if (InBytes.Num() > 0 && Proto.ParseFromArray(InBytes.GetData(), InBytes.Num()))\n");
+			FInstrumentationGenerator::WriteScope(Ctx, UeType, "Decode", "InBytes.Num()");
+			if (Ctx.Options.bUseDirectParse)
+			{
+				Ctx.Printer.Print("return InBytes.Num() > 0 && OutStruct.ParseDirect(InBytes.GetData(), InBytes.Num());\n");
+			}
+			else
+			{
+				WriteParseAndConvert(Ctx, ProtoType, "InBytes.Num() > 0 && Proto.ParseFromArray(InBytes.GetData(), InBytes.Num())");
+			}
+		}
+
+		{
+			FScopedBlock EncodeBlock(Ctx.Printer, 
+				"bool U" + BaseName + "ProtoLibrary::EncodeAppend(const " + UeType + "& InStruct, " + UE::Names::Types::TArray + "<uint8>& Buffer)");
+			FInstrumentationGenerator::WriteScope(Ctx, UeType, "Encode");
+			WriteSizedEncode(Ctx, ProtoType, 
+				"Size > static_cast<size_t>(MAX_int32 - Buffer.Num())", 
+				"const int32 Offset = Buffer.Num();\nBuffer.AddUninitialized(static_cast<int32>(Size));\nuint8* Target = Buffer.GetData() + Offset;\n", 
+				"Buffer.SetNum(Offset, EAllowShrinking::No);\n", "true", "false");
+		}
+
+		{
+			FScopedBlock EncodeBlock(Ctx.Printer, 
+				"int32 U" + BaseName + "ProtoLibrary::EncodeInto(const " + UeType + "& InStruct, TArrayView<uint8> OutBuffer)");
+			FInstrumentationGenerator::WriteScope(Ctx, UeType, "Encode");
+			WriteSizedEncode(Ctx, ProtoType, 
+				"Size > static_cast<size_t>(OutBuffer.Num())", 
+				"uint8* Target = OutBuffer.GetData();\n", 
+				"", "static_cast<int32>(Size)", "INDEX_NONE");
+		}
+
+		{
+			FScopedBlock EncodeBlock(Ctx.Printer, 
+				"bool U" + BaseName + "ProtoLibrary::Encode" + FuncNameSuffix + "Batch(const " + UE::Names::Types::TArray + "<" + UeType + ">& InStructs, " + UE::Names::Types::TArray + "<uint8>& OutBytes)");
+			Ctx.Printer.Print("OutBytes.Reset();\n");
+			Ctx.Printer.Print("return EncodeBatch(InStructs, OutBytes);\n");
+		}
+
+		{
+			FScopedBlock DecodeBlock(Ctx.Printer, 
+				"bool U" + BaseName + "ProtoLibrary::Decode" + FuncNameSuffix + "Batch(const " + UE::Names::Types::TArray + "<uint8>& InBytes, " + UE::Names::Types::TArray + "<" + UeType + ">& OutStructs)");
+			Ctx.Printer.Print("return DecodeBatch(MakeMemoryView(InBytes), OutStructs);\n");
+		}
+
+		{
+			FScopedBlock EncodeBlock(Ctx.Printer, 
+				"bool U" + BaseName + "ProtoLibrary::EncodeBatch(TConstArrayView<" + UeType + "> InStructs, " + UE::Names::Types::TArray + "<uint8>& Buffer)");
+			FInstrumentationGenerator::WriteScope(Ctx, UeType, "Encode", "Buffer, true");
+			WriteBatchEncode(Ctx, UeType, ProtoType);
+		}
+
+		{
+			FScopedBlock DecodeBlock(Ctx.Printer, 
+				"bool U" + BaseName + "ProtoLibrary::DecodeBatch(FMemoryView InView, " + UE::Names::Types::TArray + "<" + UeType + ">& OutStructs)");
+			FInstrumentationGenerator::WriteScope(Ctx, UeType, "Decode", "static_cast<int64>(InView.GetSize())");
+			WriteBatchDecode(Ctx, UeType, ProtoType);
+		}
+
+		{
+			FScopedBlock DecodeBlock(Ctx.Printer, 
+				"bool U" + BaseName + "ProtoLibrary::Decode" + FuncNameSuffix + "(FMemoryView InView, " + UeType + "& OutStruct)");
+			FInstrumentationGenerator::WriteScope(Ctx, UeType, "Decode", "static_cast<int64>(InView.GetSize())");
+			if (Ctx.Options.bUseDirectParse)
 			{
-				FScopedBlock IfBlock(Ctx.Printer);
-				Ctx.Printer.Print("OutStruct.FromProto(Proto);\n");
-				Ctx.Printer.Print("return true;\n");
+				Ctx.Printer.Print("return !InView.IsEmpty() && FProtobufStreamUtils::ParseDirectFromView(InView, OutStruct);\n");
 			}
+			else
+			{
+				WriteParseAndConvert(Ctx, ProtoType, "!InView.IsEmpty() && FProtobufStreamUtils::ParseFromView(InView, Proto)");
+			}
+		}
+
+		{
+			FScopedBlock DecodeBlock(Ctx.Printer, 
+				"bool U" + BaseName + "ProtoLibrary::Decode" + FuncNameSuffix + "(TArrayView<const uint8> InBytes, " + UeType + "& OutStruct)");
+			Ctx.Printer.Print("return Decode$func$(MakeMemoryView(InBytes), OutStruct);\n", "func", FuncNameSuffix);
+		}
+
+		{
+			FScopedBlock DecodeBlock(Ctx.Printer, 
+				"bool U" + BaseName + "ProtoLibrary::Decode" + FuncNameSuffix + "(FArchive& Ar, int64 Length, " + UeType + "& OutStruct)");
+			FInstrumentationGenerator::WriteScope(Ctx, UeType, "Decode", "Length");
+			if (Ctx.Options.bUseDirectParse)
+			{
+				Ctx.Printer.Print("return FProtobufStreamUtils::ParseDirectFromArchive(Ar, Length, OutStruct);\n");
+			}
+			else
+			{
+				WriteParseAndConvert(Ctx, ProtoType, "FProtobufStreamUtils::ParseFromArchive(Ar, Length, Proto)");
+			}
+		}
+	}
+}
+
+void FProtoLibraryGenerator::WriteSizedEncode(FGeneratorContext& Ctx, const std::string& ProtoType, const std::string& CapacityCheck, const std::string& TargetSetup, const std::string& FailureCleanup, const std::string& SuccessReturn, const std::string& FailureReturn)
+{
+	if (Ctx.Options.bUseDirectSerialize)
+	{
+		Ctx.Printer.Print("FProtoDirectSizeCache SizeCache;\n");
+		Ctx.Printer.Print("const size_t Size = InStruct.ByteSizeDirect(SizeCache);\n");
+	}
+	else
+	{
+		WriteProtoInstance(Ctx, ProtoType);
+		Ctx.Printer.Print("InStruct.ToProto(Proto);\n");
+		Ctx.Printer.Print("const size_t Size = Proto.ByteSizeLong();\n");
+	}
+	Ctx.Printer.Print("if ($check$) return $fail$;\n\n", "check", CapacityCheck, "fail", FailureReturn);
+	Ctx.Printer.Print(TargetSetup.c_str());
+
+	if (Ctx.Options.bUseDirectSerialize)
+	{
+		Ctx.Printer.Print("if (!InStruct.SerializeDirectToArray(Target, static_cast<int32>(Size), SizeCache))\n");
+		{
+			FScopedBlock IfBlock(Ctx.Printer);
+			Ctx.Printer.Print(FailureCleanup.c_str());
+			Ctx.Printer.Print("return $fail$;\n", "fail", FailureReturn);
+		}
+	}
+	else
+	{
+		Ctx.Printer.Print("Proto.SerializeWithCachedSizesToArray(Target);\n");
+	}
+
+	if (Ctx.Options.bUseMetrics)
+	{
+		Ctx.Printer.Print("MetricScope.SetBytes(static_cast<int64>(Size));\n");
+	}
+	Ctx.Printer.Print("return $ok$;\n", "ok", SuccessReturn);
+}
+
+void FProtoLibraryGenerator::WriteBatchEncode(FGeneratorContext& Ctx, const std::string& UeType, const std::string& ProtoType)
+{
+	Ctx.Printer.Print("const int32 StartNum = Buffer.Num();\n");
+	if (Ctx.Options.bUseDirectSerialize)
+	{
+		Ctx.Printer.Print("FProtoDirectSizeCache SizeCache;\n");
+	}
+	else
+	{
+		WriteProtoInstance(Ctx, ProtoType);
+	}
+	Ctx.Printer.Print("\n");
+
+	{
+		FScopedBlock LoopBlock(Ctx.Printer, "for (const " + UeType + "& InStruct : InStructs)");
+		if (Ctx.Options.bUseDirectSerialize)
+		{
+			Ctx.Printer.Print("SizeCache.Reset();\n");
+			Ctx.Printer.Print("const bool bWritten = FProtobufStreamUtils::AppendDelimited(Buffer, InStruct.ByteSizeDirect(SizeCache), \n");
+			Ctx.Printer.Indent();
+			Ctx.Printer.Print("[&InStruct, &SizeCache](uint8* Target, int32 Size) { return InStruct.SerializeDirectToArray(Target, Size, SizeCache); });\n");
+			Ctx.Printer.Outdent();
+		}
+		else
+		{
+			Ctx.Printer.Print("Proto.Clear();\n");
+			Ctx.Printer.Print("InStruct.ToProto(Proto);\n");
+			Ctx.Printer.Print("const bool bWritten = FProtobufStreamUtils::AppendDelimited(Buffer, Proto.ByteSizeLong(), \n");
+			Ctx.Printer.Indent();
+			Ctx.Printer.Print("[&Proto](uint8* Target, int32 Size) { Proto.SerializeWithCachedSizesToArray(Target); return true; });\n");
+			Ctx.Printer.Outdent();
+		}
+		Ctx.Printer.Print("if (!bWritten)\n");
+		{
+			FScopedBlock IfBlock(Ctx.Printer);
+			Ctx.Printer.Print("Buffer.SetNum(StartNum, EAllowShrinking::No);\n");
 			Ctx.Printer.Print("return false;\n");
 		}
 	}
+	Ctx.Printer.Print("return true;\n");
+}
+
+void FProtoLibraryGenerator::WriteBatchDecode(FGeneratorContext& Ctx, const std::string& UeType, const std::string& ProtoType)
+{
+	Ctx.Printer.Print("OutStructs.Reset();\n");
+	if (Ctx.Options.bUseDirectParse)
+	{
+		Ctx.Printer.Print("return FProtobufStreamUtils::ForEachDelimited(InView, \n");
+		Ctx.Printer.Indent();
+		Ctx.Printer.Print("[&OutStructs](const uint8* Data, int32 Size) { return OutStructs.AddDefaulted_GetRef().ParseDirect(Data, Size); });\n");
+		Ctx.Printer.Outdent();
+	}
+	else
+	{
+		WriteProtoInstance(Ctx, ProtoType);
+		Ctx.Printer.Print("return FProtobufStreamUtils::ForEachDelimited(InView, [&OutStructs, &Proto](const uint8* Data, int32 Size)\n");
+		Ctx.Printer.Print("{\n");
+		Ctx.Printer.Indent();
+		Ctx.Printer.Print("if (!Proto.ParseFromArray(Data, Size)) return false;\n");
+		Ctx.Printer.Print("OutStructs.AddDefaulted_GetRef().FromProto(Proto);\n");
+		Ctx.Printer.Print("return true;\n");
+		Ctx.Printer.Outdent();
+		Ctx.Printer.Print("});\n");
+	}
+}
+
+void FProtoLibraryGenerator::WriteParseAndConvert(FGeneratorContext& Ctx, const std::string& ProtoType, const std::string& ParseCondition)
+{
+	WriteProtoInstance(Ctx, ProtoType);
+	
+	Ctx.Printer.Print("if ($cond$)\n", "cond", ParseCondition);
+	{
+		FScopedBlock IfBlock(Ctx.Printer);
+		Ctx.Printer.Print("OutStruct.FromProto(Proto);\n");
+		Ctx.Printer.Print("return true;\n");
+	}
+	Ctx.Printer.Print("return false;\n");
+}
+
+void FProtoLibraryGenerator::WriteProtoInstance(FGeneratorContext& Ctx, const std::string& ProtoType)
+{
+	if (Ctx.Options.bUseArena)
+	{
+		Ctx.Printer.Print("FProtoArenaScope ArenaScope;\n");
+		Ctx.Printer.Print("$proto$& Proto = *google::protobuf::Arena::Create<$proto$>(ArenaScope.GetArena());\n", "proto", ProtoType);
+	}
+	else
+	{
+		Ctx.Printer.Print("$proto$ Proto;\n", "proto", ProtoType);
+	}
 }
\ No newline at end of file
@@ -15,4 +15,11 @@ class FProtoLibraryGenerator
 public:
     static void GenerateHeader(FGeneratorContext& Ctx, const std::string& BaseName, const std::vector<const google::protobuf::Descriptor*>& Messages);
     static void GenerateSource(FGeneratorContext& Ctx, const std::string& BaseName, const std::vector<const google::protobuf::Descriptor*>& Messages);
+
+private:
+    static void WriteProtoInstance(FGeneratorContext& Ctx, const std::string& ProtoType);
+    static void WriteSizedEncode(FGeneratorContext& Ctx, const std::string& ProtoType, const std::string& CapacityCheck, const std::string& TargetSetup, const std::string& FailureCleanup, const std::string& SuccessReturn, const std::string& FailureReturn);
+    static void WriteBatchEncode(FGeneratorContext& Ctx, const std::string& UeType, const std::string& ProtoType);
+    static void WriteBatchDecode(FGeneratorContext& Ctx, const std::string& UeType, const std::string& ProtoType);
+    static void WriteParseAndConvert(FGeneratorContext& Ctx, const std::string& ProtoType, const std::string& ParseCondition);
 };
\ No newline at end of file
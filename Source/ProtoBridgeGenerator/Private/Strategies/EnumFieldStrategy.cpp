@@ -52,4 +52,45 @@ void FEnumFieldStrategy::WriteSingleValueFromProto(FGeneratorContext& Ctx, const
 {
 	std::string UeType = GetCppType(Field, Ctx);
 	Ctx.Printer.Print("$target$ = static_cast<$type$>($val$);\n", "target", UeTarget, "type", UeType, "val", ProtoValue);
+}
+
+void FEnumFieldStrategy::WriteRepeatedByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	std::string Func = Field->is_packed() ? "PackedFieldSize" : "RepeatedScalarFieldSize";
+	Ctx.Printer.Print("Size += $utils$::$func$<$wire$>($num$, $ue$);\n", 
+		"utils", UE::Names::Utils::Wire, "func", Func, "wire", GetWireTypeName(Field), "num", std::to_string(Field->number()), "ue", UeVar);
+}
+
+void FEnumFieldStrategy::WriteRepeatedSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	std::string Func = Field->is_packed() ? "WritePackedField" : "WriteRepeatedScalarField";
+	Ctx.Printer.Print("$utils$::$func$<$wire$>($num$, $ue$, Stream);\n", 
+		"utils", UE::Names::Utils::Wire, "func", Func, "wire", GetWireTypeName(Field), "num", std::to_string(Field->number()), "ue", UeVar);
+}
+
+std::string FEnumFieldStrategy::GetNonDefaultCondition(const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	return std::string(UE::Names::Utils::Wire) + "::IsNonDefault(" + UeVar + ")";
+}
+
+std::string FEnumFieldStrategy::GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	return std::string(UE::Names::Utils::Wire) + "::ScalarFieldSize<" + GetWireTypeName(Field) + ">(" + std::to_string(Field->number()) + ", " + UeValue + ")";
+}
+
+void FEnumFieldStrategy::WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	Ctx.Printer.Print("$utils$::WriteScalarField<$wire$>($num$, $val$, Stream);\n", 
+		"utils", UE::Names::Utils::Wire, "wire", GetWireTypeName(Field), "num", std::to_string(Field->number()), "val", UeValue);
+}
+
+void FEnumFieldStrategy::WriteRepeatedParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	Ctx.Printer.Print("if (!$utils$::ReadRepeatedScalarField<$wire$>(Stream, Tag, $ue$)) return false;\n", 
+		"utils", UE::Names::Utils::Wire, "wire", GetWireTypeName(Field), "ue", UeVar);
+}
+
+std::string FEnumFieldStrategy::GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const
+{
+	return std::string(UE::Names::Utils::Wire) + "::ReadScalarField<" + GetWireTypeName(Field) + ">(Stream, " + TagVar + ", " + UeTarget + ")";
 }
\ No newline at end of file
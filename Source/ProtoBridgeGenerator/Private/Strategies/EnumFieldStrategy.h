@@ -7,10 +7,19 @@ public:
     virtual bool IsRepeated(const google::protobuf::FieldDescriptor* Field) const override;
     virtual std::string GetCppType(const google::protobuf::FieldDescriptor* Field, const FGeneratorContext& Ctx) const override;
 
+    virtual std::string GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const override;
+    virtual void WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const override;
+    virtual std::string GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const override;
+
 protected:
     virtual void WriteRepeatedToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const override;
     virtual void WriteRepeatedFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const override;
 
+    virtual void WriteRepeatedByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const override;
+    virtual void WriteRepeatedSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const override;
+    virtual std::string GetNonDefaultCondition(const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const override;
+    virtual void WriteRepeatedParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const override;
+
     virtual void WriteSingleValueToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue, const std::string& ProtoName) const override;
     virtual void WriteSingleValueFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& ProtoValue) const override;
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿#include "FieldStrategy.h"
+#include "../GeneratorProfiler.h"
 #include "../GeneratorContext.h"
 #include "../Config/UEDefinitions.h"
 #include <vector>
@@ -26,8 +27,14 @@ bool IFieldStrategy::CanBeUProperty(const google::protobuf::FieldDescriptor* Fie
 	return true; 
 }
 
+bool IFieldStrategy::IsBlueprintType(const google::protobuf::FieldDescriptor* Field) const
+{ 
+	return true; 
+}
+
 void IFieldStrategy::WriteDeclaration(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field) const
 {
+	BRIDGE_PROFILE_SCOPE(Strategies);
 	google::protobuf::SourceLocation Loc;
 	Field->GetSourceLocation(&Loc);
 	PrintBlockComment(Ctx, Loc);
@@ -36,7 +43,7 @@ void IFieldStrategy::WriteDeclaration(FGeneratorContext& Ctx, const google::prot
 	
 	if (CanBeUProperty(Field))
 	{
-		WritePropertyMacro(Ctx, Field, GetUESpecifiers(Loc));
+		WritePropertyMacro(Ctx, Field, GetUESpecifiers(Loc, IsBlueprintType(Field)));
 	}
 	
 	std::string TypeName = GetCppType(Field, Ctx);
@@ -50,6 +57,7 @@ void IFieldStrategy::WriteDeclaration(FGeneratorContext& Ctx, const google::prot
 
 void IFieldStrategy::WriteToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const
 {
+	BRIDGE_PROFILE_SCOPE(Strategies);
 	if (IsRepeated(Field))
 	{
 		WriteRepeatedToProto(Ctx, Field, UeVar, ProtoVar);
@@ -62,6 +70,7 @@ void IFieldStrategy::WriteToProto(FGeneratorContext& Ctx, const google::protobuf
 
 void IFieldStrategy::WriteFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const
 {
+	BRIDGE_PROFILE_SCOPE(Strategies);
 	if (IsRepeated(Field))
 	{
 		WriteRepeatedFromProto(Ctx, Field, UeVar, ProtoVar);
@@ -80,6 +89,48 @@ void IFieldStrategy::WriteFromProto(FGeneratorContext& Ctx, const google::protob
 	}
 }
 
+void IFieldStrategy::WriteByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	if (IsRepeated(Field))
+	{
+		WriteRepeatedByteSize(Ctx, Field, UeVar);
+		return;
+	}
+
+	std::string Condition = Field->has_presence() ? "" : GetNonDefaultCondition(Field, UeVar);
+	std::string SizeExpr = GetSingleValueSizeExpr(Ctx, Field, UeVar);
+	if (Condition.empty())
+	{
+		Ctx.Printer.Print("Size += $expr$;\n", "expr", SizeExpr);
+	}
+	else
+	{
+		Ctx.Printer.Print("if ($cond$) Size += $expr$;\n", "cond", Condition, "expr", SizeExpr);
+	}
+}
+
+void IFieldStrategy::WriteSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	if (IsRepeated(Field))
+	{
+		WriteRepeatedSerializeDirect(Ctx, Field, UeVar);
+		return;
+	}
+
+	std::string Condition = Field->has_presence() ? "" : GetNonDefaultCondition(Field, UeVar);
+	if (Condition.empty())
+	{
+		WriteSingleValueDirect(Ctx, Field, UeVar);
+	}
+	else
+	{
+		FScopedBlock IfBlock(Ctx.Printer, "if (" + Condition + ")");
+		WriteSingleValueDirect(Ctx, Field, UeVar);
+	}
+}
+
 void IFieldStrategy::WriteRepeatedToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const
 {
 	FScopedBlock Loop(Ctx.Printer, "for (const auto& Val : " + UeVar + ")");
@@ -92,6 +143,77 @@ void IFieldStrategy::WriteRepeatedFromProto(FGeneratorContext& Ctx, const google
 	WriteSingleValueFromProto(Ctx, Field, UeVar + ".AddDefaulted_GetRef()", "Val");
 }
 
+void IFieldStrategy::WriteRepeatedByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	Ctx.Printer.Print("for (const auto& Val : $ue$) Size += $expr$;\n", "ue", UeVar, "expr", GetSingleValueSizeExpr(Ctx, Field, "Val"));
+}
+
+void IFieldStrategy::WriteRepeatedSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	FScopedBlock Loop(Ctx.Printer, "for (const auto& Val : " + UeVar + ")");
+	WriteSingleValueDirect(Ctx, Field, "Val");
+}
+
+void IFieldStrategy::WriteParseReset(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	if (IsRepeated(Field))
+	{
+		Ctx.Printer.Print("$ue$.Reset();\n", "ue", UeVar);
+	}
+	else if (!Field->has_presence())
+	{
+		Ctx.Printer.Print("$ue$ = {};\n", "ue", UeVar);
+	}
+}
+
+void IFieldStrategy::WriteParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	if (IsRepeated(Field))
+	{
+		WriteRepeatedParseDirect(Ctx, Field, UeVar);
+	}
+	else
+	{
+		Ctx.Printer.Print("if (!$expr$) return false;\n", "expr", GetSingleValueReadExpr(Ctx, Field, UeVar, "Tag"));
+	}
+}
+
+void IFieldStrategy::WriteRepeatedParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	Ctx.Printer.Print("if (!$utils$::ReadRepeatedElement(Stream, Tag, $ue$, [&]($type$& Val) { return $expr$; })) return false;\n", 
+		"utils", UE::Names::Utils::Wire, "ue", UeVar, "type", GetCppType(Field, Ctx), "expr", GetSingleValueReadExpr(Ctx, Field, "Val", "Tag"));
+}
+
+std::string IFieldStrategy::GetNonDefaultCondition(const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	return "";
+}
+
+std::string IFieldStrategy::GetWireTypeName(const google::protobuf::FieldDescriptor* Field)
+{
+	std::string Prefix = std::string(UE::Names::Types::EProtoWireType) + "::";
+	switch (Field->type())
+	{
+	case google::protobuf::FieldDescriptor::TYPE_DOUBLE: return Prefix + "Double";
+	case google::protobuf::FieldDescriptor::TYPE_FLOAT: return Prefix + "Float";
+	case google::protobuf::FieldDescriptor::TYPE_INT64: return Prefix + "Int64";
+	case google::protobuf::FieldDescriptor::TYPE_UINT64: return Prefix + "UInt64";
+	case google::protobuf::FieldDescriptor::TYPE_INT32: return Prefix + "Int32";
+	case google::protobuf::FieldDescriptor::TYPE_FIXED64: return Prefix + "Fixed64";
+	case google::protobuf::FieldDescriptor::TYPE_FIXED32: return Prefix + "Fixed32";
+	case google::protobuf::FieldDescriptor::TYPE_BOOL: return Prefix + "Bool";
+	case google::protobuf::FieldDescriptor::TYPE_UINT32: return Prefix + "UInt32";
+	case google::protobuf::FieldDescriptor::TYPE_SFIXED32: return Prefix + "SFixed32";
+	case google::protobuf::FieldDescriptor::TYPE_SFIXED64: return Prefix + "SFixed64";
+	case google::protobuf::FieldDescriptor::TYPE_SINT32: return Prefix + "SInt32";
+	case google::protobuf::FieldDescriptor::TYPE_SINT64: return Prefix + "SInt64";
+	case google::protobuf::FieldDescriptor::TYPE_ENUM: return Prefix + "Enum";
+	default: return Prefix + "Int32";
+	}
+}
+
 void IFieldStrategy::PrintBlockComment(FGeneratorContext& Ctx, const google::protobuf::SourceLocation& Location)
 {
 	if (Location.leading_comments.empty()) return;
@@ -112,14 +234,24 @@ void IFieldStrategy::PrintBlockComment(FGeneratorContext& Ctx, const google::pro
 	Ctx.Printer.Print(" */\n");
 }
 
-std::string IFieldStrategy::GetUESpecifiers(const google::protobuf::SourceLocation& Location) const
+std::string IFieldStrategy::GetUESpecifiers(const google::protobuf::SourceLocation& Location, bool bBlueprintVisible) const
 {
-	std::string Specifiers = std::string(UE::Names::Specifiers::EditAnywhere) + ", " + UE::Names::Specifiers::BlueprintReadWrite;
+	std::string Specifiers = UE::Names::Specifiers::EditAnywhere;
 	std::string Comments = Location.leading_comments + Location.trailing_comments;
 	
 	if (Comments.find("@BlueprintReadOnly") != std::string::npos)
 	{
-		Specifiers = std::string(UE::Names::Specifiers::VisibleAnywhere) + ", " + UE::Names::Specifiers::BlueprintReadOnly;
+		Specifiers = UE::Names::Specifiers::VisibleAnywhere;
+		if (bBlueprintVisible)
+		{
+			Specifiers += ", ";
+			Specifiers += UE::Names::Specifiers::BlueprintReadOnly;
+		}
+	}
+	else if (bBlueprintVisible)
+	{
+		Specifiers += ", ";
+		Specifiers += UE::Names::Specifiers::BlueprintReadWrite;
 	}
 
 	Specifiers += ", ";
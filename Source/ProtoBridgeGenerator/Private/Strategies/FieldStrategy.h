@@ -19,12 +19,24 @@ public:
 	virtual std::string GetCppType(const google::protobuf::FieldDescriptor* Field, const FGeneratorContext& Ctx) const = 0;
 	virtual bool IsRepeated(const google::protobuf::FieldDescriptor* Field) const;
 	virtual bool CanBeUProperty(const google::protobuf::FieldDescriptor* Field) const;
+	/** False for property types UHT rejects in Blueprint, which are then declared without Blueprint specifiers. */
+	virtual bool IsBlueprintType(const google::protobuf::FieldDescriptor* Field) const;
 
 	virtual void WriteDeclaration(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field) const;
 	
 	virtual void WriteToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const;
 	virtual void WriteFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const;
 
+	virtual void WriteByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const;
+	virtual void WriteSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const;
+
+	virtual std::string GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const = 0;
+	virtual void WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const = 0;
+
+	virtual void WriteParseReset(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const;
+	virtual void WriteParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const;
+	virtual std::string GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const = 0;
+
 protected:
 	virtual void WriteRepeatedToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const;
 	virtual void WriteRepeatedFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const;
@@ -32,7 +44,13 @@ protected:
 	virtual void WriteSingleValueToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue, const std::string& ProtoName) const = 0;
 	virtual void WriteSingleValueFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& ProtoValue) const = 0;
 
+	virtual void WriteRepeatedByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const;
+	virtual void WriteRepeatedSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const;
+	virtual std::string GetNonDefaultCondition(const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const;
+	virtual void WriteRepeatedParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const;
+
+	static std::string GetWireTypeName(const google::protobuf::FieldDescriptor* Field);
 	static void PrintBlockComment(FGeneratorContext& Ctx, const google::protobuf::SourceLocation& Location);
-	std::string GetUESpecifiers(const google::protobuf::SourceLocation& Location) const;
+	std::string GetUESpecifiers(const google::protobuf::SourceLocation& Location, bool bBlueprintVisible) const;
 	void WritePropertyMacro(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& Specifiers) const;
 };
\ No newline at end of file
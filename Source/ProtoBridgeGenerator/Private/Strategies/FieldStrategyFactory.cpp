@@ -1,4 +1,5 @@
 ﻿#include "FieldStrategyFactory.h"
+#include "../GeneratorProfiler.h"
 #include "StrategyPool.h"
 #include "UnrealStrategies.h"
 #include "../TypeRegistry.h"
@@ -17,6 +18,7 @@
 
 const IFieldStrategy* FFieldStrategyFactory::GetStrategy(const google::protobuf::FieldDescriptor* Field, const FStrategyPool& Pool)
 {
+	BRIDGE_PROFILE_SCOPE(Strategies);
 	if (Field->is_map())
 	{
 		return Pool.GetMapStrategy();
@@ -1,4 +1,6 @@
 ﻿#include "MapFieldStrategy.h"
+#include "../GeneratorProfiler.h"
+#include "FieldStrategyFactory.h"
 #include "../GeneratorContext.h"
 #include "../TypeRegistry.h"
 #include "../Config/UEDefinitions.h"
@@ -12,6 +14,11 @@
 #pragma warning(pop)
 #endif
 
+FMapFieldStrategy::FMapFieldStrategy(const FStrategyPool& InPool)
+	: Pool(InPool)
+{
+}
+
 bool FMapFieldStrategy::IsRepeated(const google::protobuf::FieldDescriptor* Field) const { return false; } 
 
 bool FMapFieldStrategy::CanBeUProperty(const google::protobuf::FieldDescriptor* Field) const
@@ -20,7 +27,7 @@ bool FMapFieldStrategy::CanBeUProperty(const google::protobuf::FieldDescriptor*
 	if (ValueField->type() == google::protobuf::FieldDescriptor::TYPE_MESSAGE)
 	{
 		const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(ValueField->message_type()->full_name()));
-		if (Info && !Info->bCanBeUProperty)
+		if (Info && (!Info->bCanBeUProperty || Info->bIsContainer))
 		{
 			return false;
 		}
@@ -28,6 +35,17 @@ bool FMapFieldStrategy::CanBeUProperty(const google::protobuf::FieldDescriptor*
 	return true;
 }
 
+bool FMapFieldStrategy::IsBlueprintType(const google::protobuf::FieldDescriptor* Field) const
+{
+	const google::protobuf::FieldDescriptor* ValueField = Field->message_type()->field(1);
+	if (ValueField->type() == google::protobuf::FieldDescriptor::TYPE_MESSAGE)
+	{
+		const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(ValueField->message_type()->full_name()));
+		return !Info || Info->bIsBlueprintType;
+	}
+	return true;
+}
+
 std::string FMapFieldStrategy::GetCppType(const google::protobuf::FieldDescriptor* Field, const FGeneratorContext& Ctx) const
 {
 	const google::protobuf::FieldDescriptor* KeyField = Field->message_type()->field(0);
@@ -41,6 +59,7 @@ std::string FMapFieldStrategy::GetCppType(const google::protobuf::FieldDescripto
 
 void FMapFieldStrategy::WriteToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const
 {
+	BRIDGE_PROFILE_SCOPE(Strategies);
 	const google::protobuf::FieldDescriptor* KeyField = Field->message_type()->field(0);
 	const google::protobuf::FieldDescriptor* ValueField = Field->message_type()->field(1);
 
@@ -94,6 +113,7 @@ void FMapFieldStrategy::WriteToProto(FGeneratorContext& Ctx, const google::proto
 
 void FMapFieldStrategy::WriteFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const
 {
+	BRIDGE_PROFILE_SCOPE(Strategies);
 	const google::protobuf::FieldDescriptor* KeyField = Field->message_type()->field(0);
 	const google::protobuf::FieldDescriptor* ValueField = Field->message_type()->field(1);
 
@@ -150,6 +170,91 @@ void FMapFieldStrategy::WriteSingleValueFromProto(FGeneratorContext& Ctx, const
 {
 }
 
+void FMapFieldStrategy::WriteByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	if (!CachesEntrySize(Field))
+	{
+		Ctx.Printer.Print("for (const auto& Elem : $ue$) Size += $utils$::MessageFieldSize($num$, $entry$);\n", 
+			"ue", UeVar, "utils", UE::Names::Utils::Wire, "num", std::to_string(Field->number()), "entry", GetEntrySizeExpr(Ctx, Field));
+		return;
+	}
+
+	// The entry slot is reserved before the value is measured so the write pass consumes it ahead of the value's own slots.
+	FScopedBlock Loop(Ctx.Printer, "for (const auto& Elem : " + UeVar + ")");
+	Ctx.Printer.Print("const int32 EntrySlot = SizeCache.ReserveSize();\n");
+	Ctx.Printer.Print("const size_t EntrySize = $entry$;\n", "entry", GetEntrySizeExpr(Ctx, Field));
+	Ctx.Printer.Print("SizeCache.SetSize(EntrySlot, EntrySize);\n");
+	Ctx.Printer.Print("Size += $utils$::MessageFieldSize($num$, EntrySize);\n", "utils", UE::Names::Utils::Wire, "num", std::to_string(Field->number()));
+}
+
+void FMapFieldStrategy::WriteSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	const google::protobuf::FieldDescriptor* KeyField = Field->message_type()->field(0);
+	const google::protobuf::FieldDescriptor* ValueField = Field->message_type()->field(1);
+
+	FScopedBlock Loop(Ctx.Printer, "for (const auto& Elem : " + UeVar + ")");
+	Ctx.Printer.Print("$utils$::WriteMessageHeader($num$, $entry$, Stream);\n", 
+		"utils", UE::Names::Utils::Wire, "num", std::to_string(Field->number()), "entry", CachesEntrySize(Field) ? "SizeCache.ConsumeSize()" : GetEntrySizeExpr(Ctx, Field));
+	FFieldStrategyFactory::GetStrategy(KeyField, Pool)->WriteSingleValueDirect(Ctx, KeyField, "Elem.Key");
+	FFieldStrategyFactory::GetStrategy(ValueField, Pool)->WriteSingleValueDirect(Ctx, ValueField, "Elem.Value");
+}
+
+std::string FMapFieldStrategy::GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	return "0";
+}
+
+void FMapFieldStrategy::WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+}
+
+void FMapFieldStrategy::WriteParseReset(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	Ctx.Printer.Print("$ue$.Reset();\n", "ue", UeVar);
+}
+
+void FMapFieldStrategy::WriteParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	const google::protobuf::FieldDescriptor* KeyField = Field->message_type()->field(0);
+	const google::protobuf::FieldDescriptor* ValueField = Field->message_type()->field(1);
+
+	Ctx.Printer.Print("if (!$utils$::ReadMapEntryField(Stream, Tag, $ue$, \n", "utils", UE::Names::Utils::Wire, "ue", UeVar);
+	Ctx.Printer.Indent();
+	Ctx.Printer.Print("[&](uint32 EntryTag, $type$& InKey) { return $expr$; }, \n", 
+		"type", GetUeTypeName(KeyField, Ctx), "expr", FFieldStrategyFactory::GetStrategy(KeyField, Pool)->GetSingleValueReadExpr(Ctx, KeyField, "InKey", "EntryTag"));
+	Ctx.Printer.Print("[&](uint32 EntryTag, $type$& InValue) { return $expr$; })) return false;\n", 
+		"type", GetUeTypeName(ValueField, Ctx), "expr", FFieldStrategyFactory::GetStrategy(ValueField, Pool)->GetSingleValueReadExpr(Ctx, ValueField, "InValue", "EntryTag"));
+	Ctx.Printer.Outdent();
+}
+
+std::string FMapFieldStrategy::GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const
+{
+	return "true";
+}
+
+bool FMapFieldStrategy::CachesEntrySize(const google::protobuf::FieldDescriptor* Field) const
+{
+	// Message values and strings reserve SizeCache slots while measuring, so the write pass cannot re-measure the entry.
+	const google::protobuf::FieldDescriptor* KeyField = Field->message_type()->field(0);
+	const google::protobuf::FieldDescriptor* ValueField = Field->message_type()->field(1);
+	return ValueField->type() == google::protobuf::FieldDescriptor::TYPE_MESSAGE
+		|| ValueField->type() == google::protobuf::FieldDescriptor::TYPE_STRING
+		|| KeyField->type() == google::protobuf::FieldDescriptor::TYPE_STRING;
+}
+
+std::string FMapFieldStrategy::GetEntrySizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field) const
+{
+	const google::protobuf::FieldDescriptor* KeyField = Field->message_type()->field(0);
+	const google::protobuf::FieldDescriptor* ValueField = Field->message_type()->field(1);
+
+	return FFieldStrategyFactory::GetStrategy(KeyField, Pool)->GetSingleValueSizeExpr(Ctx, KeyField, "Elem.Key") + " + " 
+		+ FFieldStrategyFactory::GetStrategy(ValueField, Pool)->GetSingleValueSizeExpr(Ctx, ValueField, "Elem.Value");
+}
+
 std::string FMapFieldStrategy::GetUeTypeName(const google::protobuf::FieldDescriptor* F, const FGeneratorContext& Ctx) const
 {
 	namespace Types = UE::Names::Types;
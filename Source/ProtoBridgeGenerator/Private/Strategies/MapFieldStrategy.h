@@ -1,20 +1,39 @@
 #pragma once
 #include "FieldStrategy.h"
 
+class FStrategyPool;
+
 class FMapFieldStrategy : public IFieldStrategy
 {
 public:
+	explicit FMapFieldStrategy(const FStrategyPool& InPool);
+
 	virtual bool IsRepeated(const google::protobuf::FieldDescriptor* Field) const override;
 	virtual bool CanBeUProperty(const google::protobuf::FieldDescriptor* Field) const override;
+	virtual bool IsBlueprintType(const google::protobuf::FieldDescriptor* Field) const override;
 	virtual std::string GetCppType(const google::protobuf::FieldDescriptor* Field, const FGeneratorContext& Ctx) const override;
 
 	virtual void WriteToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const override;
 	virtual void WriteFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const override;
 
+	virtual void WriteByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const override;
+	virtual void WriteSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const override;
+
+	virtual std::string GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const override;
+	virtual void WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const override;
+
+	virtual void WriteParseReset(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const override;
+	virtual void WriteParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const override;
+	virtual std::string GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const override;
+
 protected:
 	virtual void WriteSingleValueToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue, const std::string& ProtoName) const override;
 	virtual void WriteSingleValueFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& ProtoValue) const override;
 
 private:
 	std::string GetUeTypeName(const google::protobuf::FieldDescriptor* F, const FGeneratorContext& Ctx) const;
+	std::string GetEntrySizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field) const;
+	bool CachesEntrySize(const google::protobuf::FieldDescriptor* Field) const;
+
+	const FStrategyPool& Pool;
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿#include "MessageFieldStrategy.h"
+#include "../GeneratorProfiler.h"
 #include "../GeneratorContext.h"
 #include "../Config/UEDefinitions.h"
 
@@ -61,4 +62,34 @@ void FMessageFieldStrategy::WriteSingleValueToProto(FGeneratorContext& Ctx, cons
 void FMessageFieldStrategy::WriteSingleValueFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& ProtoValue) const
 {
 	Ctx.Printer.Print("$target$.FromProto($val$);\n", "target", UeTarget, "val", ProtoValue);
+}
+
+std::string FMessageFieldStrategy::GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	return std::string(UE::Names::Utils::Wire) + "::StructFieldSize(" + std::to_string(Field->number()) + ", " + UeValue + ", SizeCache)";
+}
+
+void FMessageFieldStrategy::WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	Ctx.Printer.Print("$utils$::WriteStructField($num$, $val$, SizeCache, Stream);\n", 
+		"utils", UE::Names::Utils::Wire, "num", std::to_string(Field->number()), "val", UeValue);
+}
+
+std::string FMessageFieldStrategy::GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const
+{
+	return std::string(UE::Names::Utils::Wire) + "::ReadStructField(Stream, " + TagVar + ", " + UeTarget + ")";
+}
+
+void FMessageFieldStrategy::WriteParseReset(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	// Nested reads merge into the field, so the top-level parse has to clear it even though it tracks presence.
+	if (IsRepeated(Field))
+	{
+		Ctx.Printer.Print("$ue$.Reset();\n", "ue", UeVar);
+	}
+	else
+	{
+		Ctx.Printer.Print("$ue$ = {};\n", "ue", UeVar);
+	}
 }
\ No newline at end of file
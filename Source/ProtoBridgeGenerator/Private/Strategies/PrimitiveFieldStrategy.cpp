@@ -64,4 +64,45 @@ void FPrimitiveFieldStrategy::WriteSingleValueToProto(FGeneratorContext& Ctx, co
 void FPrimitiveFieldStrategy::WriteSingleValueFromProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& ProtoValue) const
 {
 	Ctx.Printer.Print("$target$ = $val$;\n", "target", UeTarget, "val", ProtoValue);
+}
+
+void FPrimitiveFieldStrategy::WriteRepeatedByteSize(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	std::string Func = Field->is_packed() ? "PackedFieldSize" : "RepeatedScalarFieldSize";
+	Ctx.Printer.Print("Size += $utils$::$func$<$wire$>($num$, $ue$);\n", 
+		"utils", UE::Names::Utils::Wire, "func", Func, "wire", GetWireTypeName(Field), "num", std::to_string(Field->number()), "ue", UeVar);
+}
+
+void FPrimitiveFieldStrategy::WriteRepeatedSerializeDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	std::string Func = Field->is_packed() ? "WritePackedField" : "WriteRepeatedScalarField";
+	Ctx.Printer.Print("$utils$::$func$<$wire$>($num$, $ue$, Stream);\n", 
+		"utils", UE::Names::Utils::Wire, "func", Func, "wire", GetWireTypeName(Field), "num", std::to_string(Field->number()), "ue", UeVar);
+}
+
+std::string FPrimitiveFieldStrategy::GetNonDefaultCondition(const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	return std::string(UE::Names::Utils::Wire) + "::IsNonDefault(" + UeVar + ")";
+}
+
+std::string FPrimitiveFieldStrategy::GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	return std::string(UE::Names::Utils::Wire) + "::ScalarFieldSize<" + GetWireTypeName(Field) + ">(" + std::to_string(Field->number()) + ", " + UeValue + ")";
+}
+
+void FPrimitiveFieldStrategy::WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	Ctx.Printer.Print("$utils$::WriteScalarField<$wire$>($num$, $val$, Stream);\n", 
+		"utils", UE::Names::Utils::Wire, "wire", GetWireTypeName(Field), "num", std::to_string(Field->number()), "val", UeValue);
+}
+
+void FPrimitiveFieldStrategy::WriteRepeatedParseDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	Ctx.Printer.Print("if (!$utils$::ReadRepeatedScalarField<$wire$>(Stream, Tag, $ue$)) return false;\n", 
+		"utils", UE::Names::Utils::Wire, "wire", GetWireTypeName(Field), "ue", UeVar);
+}
+
+std::string FPrimitiveFieldStrategy::GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const
+{
+	return std::string(UE::Names::Utils::Wire) + "::ReadScalarField<" + GetWireTypeName(Field) + ">(Stream, " + TagVar + ", " + UeTarget + ")";
 }
\ No newline at end of file
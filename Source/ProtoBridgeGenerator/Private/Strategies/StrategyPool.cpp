@@ -6,7 +6,7 @@ FStrategyPool::FStrategyPool()
 	String = std::make_unique<FStringFieldStrategy>();
 	Enum = std::make_unique<FEnumFieldStrategy>();
 	Message = std::make_unique<FMessageFieldStrategy>();
-	Map = std::make_unique<FMapFieldStrategy>();
+	Map = std::make_unique<FMapFieldStrategy>(*this);
 	UnrealStruct = std::make_unique<FUnrealStructStrategy>();
 	UnrealJson = std::make_unique<FUnrealJsonStrategy>();
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿#include "StringFieldStrategy.h"
+#include "../GeneratorProfiler.h"
 #include "../GeneratorContext.h"
 #include "../Config/UEDefinitions.h"
 
@@ -83,4 +84,47 @@ void FStringFieldStrategy::WriteSingleValueFromProto(FGeneratorContext& Ctx, con
 		Ctx.Printer.Print("$target$ = $utils$::StdStringToFString($val$);\n", 
 			"target", UeTarget, "utils", UE::Names::Utils::String, "val", ProtoValue);
 	}
+}
+
+std::string FStringFieldStrategy::GetNonDefaultCondition(const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	return (Field->type() == google::protobuf::FieldDescriptor::TYPE_BYTES) 
+		? UeVar + ".Num() > 0" 
+		: "!" + UeVar + ".IsEmpty()";
+}
+
+std::string FStringFieldStrategy::GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	if (Field->type() == google::protobuf::FieldDescriptor::TYPE_BYTES)
+	{
+		return std::string(UE::Names::Utils::Wire) + "::BytesFieldSize(" + std::to_string(Field->number()) + ", " + UeValue + ")";
+	}
+	return std::string(UE::Names::Utils::Wire) + "::StringFieldSize(" + std::to_string(Field->number()) + ", " + UeValue + ", SizeCache)";
+}
+
+void FStringFieldStrategy::WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	if (Field->type() == google::protobuf::FieldDescriptor::TYPE_BYTES)
+	{
+		Ctx.Printer.Print("$utils$::WriteBytesField($num$, $val$, Stream);\n", 
+			"utils", UE::Names::Utils::Wire, "num", std::to_string(Field->number()), "val", UeValue);
+		return;
+	}
+	Ctx.Printer.Print("$utils$::WriteStringField($num$, $val$, SizeCache, Stream);\n", 
+		"utils", UE::Names::Utils::Wire, "num", std::to_string(Field->number()), "val", UeValue);
+}
+
+void FStringFieldStrategy::WriteParseReset(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar) const
+{
+	BRIDGE_PROFILE_SCOPE(Strategies);
+	if (IsRepeated(Field) || !Field->has_presence())
+	{
+		Ctx.Printer.Print("$ue$.Reset();\n", "ue", UeVar);
+	}
+}
+
+std::string FStringFieldStrategy::GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const
+{
+	std::string Func = (Field->type() == google::protobuf::FieldDescriptor::TYPE_BYTES) ? "ReadBytesField" : "ReadStringField";
+	return std::string(UE::Names::Utils::Wire) + "::" + Func + "(Stream, " + TagVar + ", " + UeTarget + ")";
 }
\ No newline at end of file
@@ -23,7 +23,14 @@ std::string FUnrealStructStrategy::GetCppType(const google::protobuf::FieldDescr
 bool FUnrealStructStrategy::CanBeUProperty(const google::protobuf::FieldDescriptor* Field) const 
 { 
 	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
-	return Info ? Info->bCanBeUProperty : true; 
+	if (!Info) return true;
+	return Info->bCanBeUProperty && !(Info->bIsContainer && IsRepeated(Field)); 
+}
+
+bool FUnrealStructStrategy::IsBlueprintType(const google::protobuf::FieldDescriptor* Field) const 
+{ 
+	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
+	return !Info || Info->bIsBlueprintType; 
 }
 
 void FUnrealStructStrategy::WriteRepeatedToProto(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeVar, const std::string& ProtoVar) const
@@ -82,6 +89,67 @@ void FUnrealStructStrategy::WriteSingleValueFromProto(FGeneratorContext& Ctx, co
 	Ctx.Printer.Print("$target$ = $func$($val$);\n", "target", UeTarget, "func", FuncName, "val", ProtoValue);
 }
 
+std::string FUnrealStructStrategy::GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
+	if (!Info) return "0";
+
+	std::string Wire = UE::Names::Utils::Wire;
+	std::string Num = std::to_string(Field->number());
+	if (!Info->DirectSizeFunc.empty())
+	{
+		return Wire + "::MessageFieldSize(" + Num + ", " + Wire + "::" + Info->DirectSizeFunc + "(" + UeValue + "))";
+	}
+
+	std::string ProtoType = Ctx.NameResolver.GetProtoCppType(Field->message_type());
+	return Wire + "::ConvertedMessageFieldSize<" + ProtoType + ">(" + Num + ", " + UeValue + ", " + GetConverterLambda(Ctx, Field) + ", SizeCache)";
+}
+
+void FUnrealStructStrategy::WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
+	if (!Info) return;
+
+	std::string Num = std::to_string(Field->number());
+	if (!Info->DirectSizeFunc.empty())
+	{
+		Ctx.Printer.Print("$utils$::WriteMessageHeader($num$, $utils$::$size$($val$), Stream);\n", 
+			"utils", UE::Names::Utils::Wire, "num", Num, "size", Info->DirectSizeFunc, "val", UeValue);
+		Ctx.Printer.Print("$utils$::$write$($val$, Stream);\n", 
+			"utils", UE::Names::Utils::Wire, "write", Info->DirectWriteFunc, "val", UeValue);
+		return;
+	}
+
+	Ctx.Printer.Print("$utils$::WriteConvertedMessageField($num$, SizeCache, Stream);\n", "utils", UE::Names::Utils::Wire, "num", Num);
+}
+
+std::string FUnrealStructStrategy::GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const
+{
+	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
+	if (!Info) return "true";
+
+	std::string Wire = UE::Names::Utils::Wire;
+	if (!Info->DirectReadFunc.empty())
+	{
+		return Wire + "::ReadMessageField(Stream, " + TagVar + ", " + UeTarget + ", &" + Wire + "::" + Info->DirectReadFunc + ")";
+	}
+
+	std::string ProtoType = Ctx.NameResolver.GetProtoCppType(Field->message_type());
+	std::string FuncName = Info->UtilityClass + "::" + Info->FromProtoFunc;
+	return Wire + "::ReadConvertedMessageField<" + ProtoType + ">(Stream, " + TagVar + ", " + UeTarget + ", [](const " + ProtoType + "& In) { return " + FuncName + "(In); })";
+}
+
+std::string FUnrealStructStrategy::GetConverterLambda(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field) const
+{
+	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
+	std::string UeType = GetCppType(Field, Ctx);
+	std::string ProtoType = Ctx.NameResolver.GetProtoCppType(Field->message_type());
+	std::string FuncName = Info->UtilityClass + "::" + Info->ToProtoFunc;
+	std::string ArgPrefix = Info->bIsCustomType ? "&" : "";
+
+	return "[](const " + UeType + "& In, " + ProtoType + "& Out) { " + FuncName + "(In, " + ArgPrefix + "Out); }";
+}
+
 bool FUnrealJsonStrategy::IsRepeated(const google::protobuf::FieldDescriptor* Field) const { return Field->is_repeated(); }
 
 std::string FUnrealJsonStrategy::GetCppType(const google::protobuf::FieldDescriptor* Field, const FGeneratorContext& Ctx) const 
@@ -123,4 +191,33 @@ void FUnrealJsonStrategy::WriteSingleValueFromProto(FGeneratorContext& Ctx, cons
 	Ctx.Printer.Print("$target$ = $func$($val$, SerCtx);\n", "target", UeTarget, "func", FuncName, "val", ProtoValue);
 	Ctx.Printer.Outdent();
 	Ctx.Printer.Print("}\n");
+}
+
+std::string FUnrealJsonStrategy::GetSingleValueSizeExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
+	if (!Info) return "0";
+
+	std::string ProtoType = Ctx.NameResolver.GetProtoCppType(Field->message_type());
+	std::string Lambda = "[](const " + GetCppType(Field, Ctx) + "& In, " + ProtoType + "& Out) { FProtoSerializationContext SerCtx; " + Info->UtilityClass + "::" + Info->ToProtoFunc + "(In, Out, SerCtx); }";
+	return std::string(UE::Names::Utils::Wire) + "::ConvertedMessageFieldSize<" + ProtoType + ">(" + std::to_string(Field->number()) + ", " + UeValue + ", " + Lambda + ", SizeCache)";
+}
+
+void FUnrealJsonStrategy::WriteSingleValueDirect(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeValue) const
+{
+	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
+	if (!Info) return;
+
+	Ctx.Printer.Print("$utils$::WriteConvertedMessageField($num$, SizeCache, Stream);\n", "utils", UE::Names::Utils::Wire, "num", std::to_string(Field->number()));
+}
+
+std::string FUnrealJsonStrategy::GetSingleValueReadExpr(FGeneratorContext& Ctx, const google::protobuf::FieldDescriptor* Field, const std::string& UeTarget, const std::string& TagVar) const
+{
+	const FUnrealTypeInfo* Info = FTypeRegistry::GetInfo(std::string(Field->message_type()->full_name()));
+	if (!Info) return "true";
+
+	std::string ProtoType = Ctx.NameResolver.GetProtoCppType(Field->message_type());
+	std::string FuncName = Info->UtilityClass + "::" + Info->FromProtoFunc;
+	return std::string(UE::Names::Utils::Wire) + "::ReadConvertedMessageField<" + ProtoType + ">(Stream, " + TagVar + ", " + UeTarget 
+		+ ", [](const " + ProtoType + "& In) { FProtoSerializationContext SerCtx; return " + FuncName + "(In, SerCtx); })";
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 ﻿#include "TypeRegistry.h"
+#include "GeneratorProfiler.h"
 #include "Config/UEDefinitions.h"
 #include <unordered_map>
 
 const FUnrealTypeInfo* FTypeRegistry::GetInfo(const std::string& FullProtoName)
 {
+	BRIDGE_PROFILE_SCOPE(TypeRegistry);
 	namespace Utils = UE::Names::Utils;
 	
 	static const std::unordered_map<std::string, FUnrealTypeInfo> Registry = {
@@ -13,16 +15,26 @@ const FUnrealTypeInfo* FTypeRegistry::GetInfo(const std::string& FullProtoName)
 		{"google.protobuf.Struct", {std::string(UE::Names::Types::TSharedPtr) + "<" + UE::Names::Types::FJsonObject + ">", Utils::Struct, "JsonObjectToProtoStruct", "ProtoStructToJsonObject", false, false}},
 		{"google.protobuf.ListValue", {std::string(UE::Names::Types::TArray) + "<" + std::string(UE::Names::Types::TSharedPtr) + "<" + UE::Names::Types::FJsonValue + ">>", Utils::Struct, "JsonListToProto", "ProtoToJsonList", false, false}},
 		{"google.protobuf.Any", {"FProtobufAny", Utils::Reflection, "AnyToProto", "ProtoToAny", false, true}},
+		{"google.protobuf.FieldMask", {"FProtoFieldMask", Utils::FieldMask, "FieldMaskToProto", "ProtoToFieldMask", false, false}},
 		
-		{"UnrealCommon.FVectorProto", {"FVector", Utils::Math, "FVectorToProto", "ProtoToFVector", true, true}},
-		{"UnrealCommon.FVector2DProto", {"FVector2D", Utils::Math, "FVector2DToProto", "ProtoToFVector2D", true, true}},
-		{"UnrealCommon.FQuatProto", {"FQuat", Utils::Math, "FQuatToProto", "ProtoToFQuat", true, true}},
-		{"UnrealCommon.FRotatorProto", {"FRotator", Utils::Math, "FRotatorToProto", "ProtoToFRotator", true, true}},
-		{"UnrealCommon.FTransformProto", {"FTransform", Utils::Math, "FTransformToProto", "ProtoToFTransform", true, true}},
+		{"UnrealCommon.FVectorProto", {"FVector", Utils::Math, "FVectorToProto", "ProtoToFVector", true, true, "FVectorSize", "WriteFVector", "ReadFVector"}},
+		{"UnrealCommon.FVector3fProto", {"FVector3f", Utils::Math, "FVector3fToProto", "ProtoToFVector3f", true, true, "FVector3fSize", "WriteFVector3f", "ReadFVector3f", false, false}},
+		{"UnrealCommon.FVectorQuantizedProto", {"FVector", Utils::Math, "FVectorToQuantizedProto", "ProtoToFVectorQuantized", true, true, "FVectorQuantizedSize", "WriteFVectorQuantized", "ReadFVectorQuantized"}},
+		{"UnrealCommon.FVector2DProto", {"FVector2D", Utils::Math, "FVector2DToProto", "ProtoToFVector2D", true, true, "FVector2DSize", "WriteFVector2D", "ReadFVector2D"}},
+		{"UnrealCommon.FQuatProto", {"FQuat", Utils::Math, "FQuatToProto", "ProtoToFQuat", true, true, "FQuatSize", "WriteFQuat", "ReadFQuat"}},
+		{"UnrealCommon.FQuatCompressedProto", {"FQuat", Utils::Math, "FQuatToCompressedProto", "ProtoToFQuatCompressed", true, true, "FQuatCompressedSize", "WriteFQuatCompressed", "ReadFQuatCompressed"}},
+		{"UnrealCommon.FRotatorProto", {"FRotator", Utils::Math, "FRotatorToProto", "ProtoToFRotator", true, true, "FRotatorSize", "WriteFRotator", "ReadFRotator"}},
+		{"UnrealCommon.FRotator3fProto", {"FRotator3f", Utils::Math, "FRotator3fToProto", "ProtoToFRotator3f", true, true, "FRotator3fSize", "WriteFRotator3f", "ReadFRotator3f", false, false}},
+		{"UnrealCommon.FRotatorQuantizedProto", {"FRotator", Utils::Math, "FRotatorToQuantizedProto", "ProtoToFRotatorQuantized", true, true, "FRotatorQuantizedSize", "WriteFRotatorQuantized", "ReadFRotatorQuantized"}},
+		{"UnrealCommon.FTransformProto", {"FTransform", Utils::Math, "FTransformToProto", "ProtoToFTransform", true, true, "FTransformSize", "WriteFTransform", "ReadFTransform"}},
 		{"UnrealCommon.FMatrixProto", {"FMatrix", Utils::Math, "FMatrixToProto", "ProtoToFMatrix", true, true}},
-		{"UnrealCommon.FColorProto", {"FColor", Utils::Math, "FColorToProto", "ProtoToFColor", true, true}},
-		{"UnrealCommon.FLinearColorProto", {"FLinearColor", Utils::Math, "FLinearColorToProto", "ProtoToFLinearColor", true, true}},
-		{"UnrealCommon.FGuidProto", {"FGuid", Utils::Math, "FGuidToProto", "ProtoToFGuid", true, true}},
+		{"UnrealCommon.FColorProto", {"FColor", Utils::Math, "FColorToProto", "ProtoToFColor", true, true, "FColorSize", "WriteFColor", "ReadFColor"}},
+		{"UnrealCommon.FLinearColorProto", {"FLinearColor", Utils::Math, "FLinearColorToProto", "ProtoToFLinearColor", true, true, "FLinearColorSize", "WriteFLinearColor", "ReadFLinearColor"}},
+		{"UnrealCommon.FVector2DArrayProto", {std::string(UE::Names::Types::TArray) + "<FVector2D>", Utils::Math, "FVector2DArrayToProto", "ProtoToFVector2DArray", true, true, "FVector2DArraySize", "WriteFVector2DArray", "ReadFVector2DArray", true}},
+		{"UnrealCommon.FVectorArrayProto", {std::string(UE::Names::Types::TArray) + "<FVector>", Utils::Math, "FVectorArrayToProto", "ProtoToFVectorArray", true, true, "FVectorArraySize", "WriteFVectorArray", "ReadFVectorArray", true}},
+		{"UnrealCommon.FQuatArrayProto", {std::string(UE::Names::Types::TArray) + "<FQuat>", Utils::Math, "FQuatArrayToProto", "ProtoToFQuatArray", true, true, "FQuatArraySize", "WriteFQuatArray", "ReadFQuatArray", true}},
+		{"UnrealCommon.FTransformArrayProto", {std::string(UE::Names::Types::TArray) + "<FTransform>", Utils::Math, "FTransformArrayToProto", "ProtoToFTransformArray", true, true, "FTransformArraySize", "WriteFTransformArray", "ReadFTransformArray", true}},
+		{"UnrealCommon.FGuidProto", {"FGuid", Utils::Math, "FGuidToProto", "ProtoToFGuid", true, true, "FGuidSize", "WriteFGuid", "ReadFGuid"}},
 		
 		{"UnrealCommon.FNameProto", {"FName", Utils::String, "FNameToProto", "ProtoToFName", true, true}},
 		{"UnrealCommon.FTextProto", {"FText", Utils::String, "FTextToProto", "ProtoToFText", true, true}},
@@ -10,6 +10,11 @@ struct FUnrealTypeInfo
 	std::string FromProtoFunc;
 	bool bIsCustomType;
 	bool bCanBeUProperty;
+	std::string DirectSizeFunc;
+	std::string DirectWriteFunc;
+	std::string DirectReadFunc;
+	bool bIsContainer = false;
+	bool bIsBlueprintType = true;
 };
 
 class FTypeRegistry
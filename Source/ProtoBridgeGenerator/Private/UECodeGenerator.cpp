@@ -5,6 +5,7 @@
 #include "Strategies/StrategyPool.h"
 #include "Generators/EnumGenerator.h"
 #include "Generators/MessageGenerator.h"
+#include "Generators/MessageViewGenerator.h"
 #include "Generators/ProtoLibraryGenerator.h"
 
 #ifdef _MSC_VER
@@ -14,12 +15,19 @@
 
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/printer.h>
 
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+
 uint64_t FUeCodeGenerator::GetSupportedFeatures() const
 {
 	return FEATURE_PROTO3_OPTIONAL;
@@ -30,28 +38,126 @@ bool FUeCodeGenerator::Generate(const google::protobuf::FileDescriptor* File,
 	google::protobuf::compiler::GeneratorContext* Context,
 	std::string* Error) const
 {
-	std::string BaseName = GetFileNameWithoutExtension(std::string(File->name()));
+	FGeneratorOptions Options;
+	try
+	{
+		Options = FGeneratorOptions::Parse(Parameter);
+	}
+	catch (const std::exception& e)
+	{
+		*Error = std::string("Unreal Protobuf Plugin Error: ") + e.what();
+		return false;
+	}
+
+	FGeneratedFile Output;
+	if (!RenderFile(File, Options, Output, Error))
+	{
+		return false;
+	}
+
+	WriteFile(Context, Output);
+	return true;
+}
+
+bool FUeCodeGenerator::GenerateAll(const std::vector<const google::protobuf::FileDescriptor*>& Files,
+	const std::string& Parameter,
+	google::protobuf::compiler::GeneratorContext* Context,
+	std::string* Error) const
+{
+	FGeneratorOptions Options;
+	try
+	{
+		Options = FGeneratorOptions::Parse(Parameter);
+	}
+	catch (const std::exception& e)
+	{
+		*Error = std::string("Unreal Protobuf Plugin Error: ") + e.what();
+		return false;
+	}
+
+	const size_t NumFiles = Files.size();
+	std::vector<FGeneratedFile> Outputs(NumFiles);
+	std::vector<std::string> Errors(NumFiles);
+	std::atomic<size_t> NextIndex{0};
+	std::atomic<bool> bFailed{false};
+
+	// Indices are claimed in increasing order, so every file before the first failure is still rendered and the reported error does not depend on scheduling.
+	auto Worker = [&]()
+	{
+		while (!bFailed.load(std::memory_order_relaxed))
+		{
+			const size_t Index = NextIndex.fetch_add(1, std::memory_order_relaxed);
+			if (Index >= NumFiles) break;
+
+			if (!RenderFile(Files[Index], Options, Outputs[Index], &Errors[Index]))
+			{
+				bFailed.store(true, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	size_t NumWorkers = Options.Jobs > 0 ? static_cast<size_t>(Options.Jobs) : std::max(1u, std::thread::hardware_concurrency());
+	NumWorkers = std::min(NumWorkers, NumFiles);
+
+	std::vector<std::thread> Threads;
+	for (size_t i = 1; i < NumWorkers; ++i)
+	{
+		try
+		{
+			Threads.emplace_back(Worker);
+		}
+		catch (const std::system_error&)
+		{
+			break;
+		}
+	}
+
+	Worker();
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	for (size_t Index = 0; Index < NumFiles; ++Index)
+	{
+		if (Errors[Index].empty()) continue;
+
+		*Error = std::string(Files[Index]->name()) + ": " + Errors[Index];
+		return false;
+	}
+
+	for (const FGeneratedFile& Output : Outputs)
+	{
+		WriteFile(Context, Output);
+	}
+
+	return true;
+}
+
+bool FUeCodeGenerator::RenderFile(const google::protobuf::FileDescriptor* File, const FGeneratorOptions& Options, FGeneratedFile& OutFile, std::string* Error) const
+{
+	OutFile.BaseName = GetFileNameWithoutExtension(std::string(File->name()));
 	FGeneratorContext::Log("Processing File: " + std::string(File->name()));
 	
 	try
 	{
 		std::vector<const google::protobuf::Descriptor*> SortedMessages = FDependencySorter::Sort(File);
 		
-		FGeneratorContext Ctx(nullptr, Parameter.empty() ? "" : Parameter + " ");
+		FGeneratorContext Ctx(nullptr, Options);
 		FStrategyPool StrategyPool;
 
 		{
-			std::unique_ptr<google::protobuf::io::ZeroCopyOutputStream> HeaderOutput(Context->Open(BaseName + ".ue.h"));
-			google::protobuf::io::Printer HeaderPrinter(HeaderOutput.get(), '$');
+			google::protobuf::io::StringOutputStream HeaderOutput(&OutFile.Header);
+			google::protobuf::io::Printer HeaderPrinter(&HeaderOutput, '$');
 			Ctx.Printer = FCodePrinter(&HeaderPrinter);
-			GenerateHeader(File, BaseName, Ctx, SortedMessages, StrategyPool);
+			GenerateHeader(File, OutFile.BaseName, Ctx, SortedMessages, StrategyPool);
 		}
 
 		{
-			std::unique_ptr<google::protobuf::io::ZeroCopyOutputStream> SourceOutput(Context->Open(BaseName + ".ue.cpp"));
-			google::protobuf::io::Printer SourcePrinter(SourceOutput.get(), '$');
+			google::protobuf::io::StringOutputStream SourceOutput(&OutFile.Source);
+			google::protobuf::io::Printer SourcePrinter(&SourceOutput, '$');
 			Ctx.Printer = FCodePrinter(&SourcePrinter);
-			GenerateSource(File, BaseName, Ctx, SortedMessages, StrategyPool);
+			GenerateSource(File, OutFile.BaseName, Ctx, SortedMessages, StrategyPool);
 		}
 	}
 	catch (const std::exception& e)
@@ -63,6 +169,19 @@ bool FUeCodeGenerator::Generate(const google::protobuf::FileDescriptor* File,
 	return true;
 }
 
+void FUeCodeGenerator::WriteFile(google::protobuf::compiler::GeneratorContext* Context, const FGeneratedFile& InFile)
+{
+	const auto Write = [Context](const std::string& FileName, const std::string& Contents)
+	{
+		std::unique_ptr<google::protobuf::io::ZeroCopyOutputStream> Output(Context->Open(FileName));
+		google::protobuf::io::CodedOutputStream Coded(Output.get());
+		Coded.WriteRaw(Contents.data(), static_cast<int>(Contents.size()));
+	};
+
+	Write(InFile.BaseName + ".ue.h", InFile.Header);
+	Write(InFile.BaseName + ".ue.cpp", InFile.Source);
+}
+
 std::string FUeCodeGenerator::GetFileNameWithoutExtension(const std::string& FileName) const
 {
 	size_t LastDot = FileName.find_last_of(".");
@@ -76,10 +195,12 @@ void FUeCodeGenerator::GenerateHeader(const google::protobuf::FileDescriptor* Fi
 	Ctx.Printer.Print("#include \"CoreMinimal.h\"\n");
 	Ctx.Printer.Print("#include \"GameplayTagContainer.h\"\n");
 	Ctx.Printer.Print("#include \"UObject/SoftObjectPath.h\"\n");
+	Ctx.Printer.Print("#include \"Memory/MemoryView.h\"\n");
 	Ctx.Printer.Print("#include \"Kismet/BlueprintFunctionLibrary.h\"\n");
 	Ctx.Printer.Print("#include \"Dom/JsonObject.h\"\n");
 	Ctx.Printer.Print("#include \"Dom/JsonValue.h\"\n");
 	Ctx.Printer.Print("#include \"ProtobufAny.h\"\n");
+	Ctx.Printer.Print("#include \"ProtoFieldMask.h\"\n");
 
 	for (int i = 0; i < File->dependency_count(); ++i)
 	{
@@ -103,6 +224,7 @@ void FUeCodeGenerator::GenerateHeader(const google::protobuf::FileDescriptor* Fi
 	Ctx.Printer.Print("#if defined(_MSC_VER)\n#pragma warning(pop)\n#endif\n\n");
 
 	Ctx.Printer.Print("#include \"$filename$.ue.generated.h\"\n\n", "filename", BaseName);
+	Ctx.Printer.Print("class FProtoDirectSizeCache;\n\n");
 
 	for (int i = 0; i < File->enum_type_count(); ++i)
 	{
@@ -112,6 +234,7 @@ void FUeCodeGenerator::GenerateHeader(const google::protobuf::FileDescriptor* Fi
 	for (const google::protobuf::Descriptor* Msg : Messages)
 	{
 		FMessageGenerator::GenerateHeader(Ctx, Msg, Pool);
+		FMessageViewGenerator::GenerateHeader(Ctx, Msg, Pool);
 	}
 
 	FProtoLibraryGenerator::GenerateHeader(Ctx, BaseName, Messages);
@@ -125,6 +248,21 @@ void FUeCodeGenerator::GenerateSource(const google::protobuf::FileDescriptor* Fi
 	Ctx.Printer.Print("#include \"ProtobufStructUtils.h\"\n");
 	Ctx.Printer.Print("#include \"ProtobufReflectionUtils.h\"\n");
 	Ctx.Printer.Print("#include \"ProtobufContainerUtils.h\"\n");
+	Ctx.Printer.Print("#include \"ProtobufWireUtils.h\"\n");
+	Ctx.Printer.Print("#include \"ProtobufStreamUtils.h\"\n");
+	Ctx.Printer.Print("#include \"ProtobufDeltaUtils.h\"\n");
+	if (Ctx.Options.bUseArena)
+	{
+		Ctx.Printer.Print("#include \"ProtoBridgeArenaPool.h\"\n");
+	}
+	if (Ctx.Options.bUseMetrics)
+	{
+		Ctx.Printer.Print("#include \"ProtoBridgeMetrics.h\"\n");
+	}
+	if (Ctx.Options.bUseMemoryTags)
+	{
+		Ctx.Printer.Print("#include \"ProtoBridgeMemory.h\"\n");
+	}
 	
 	Ctx.Printer.Print("\n#pragma warning(push)\n");
 	Ctx.Printer.Print("#pragma warning(disable: 4800 4125 4668 4541 4946 4715)\n\n");
@@ -132,6 +270,7 @@ void FUeCodeGenerator::GenerateSource(const google::protobuf::FileDescriptor* Fi
 	for (const google::protobuf::Descriptor* Msg : Messages)
 	{
 		FMessageGenerator::GenerateSource(Ctx, Msg, Pool);
+		FMessageViewGenerator::GenerateSource(Ctx, Msg, Pool);
 	}
 
 	FProtoLibraryGenerator::GenerateSource(Ctx, BaseName, Messages);
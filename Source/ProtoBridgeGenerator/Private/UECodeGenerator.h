@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -15,6 +16,7 @@
 
 class FGeneratorContext;
 class FStrategyPool;
+struct FGeneratorOptions;
 namespace google {
 	namespace protobuf {
 		class FileDescriptor;
@@ -32,7 +34,22 @@ public:
 		google::protobuf::compiler::GeneratorContext* Context,
 		std::string* Error) const override;
 
+	/** Renders independent files on a worker pool, then opens and writes every output in input order on the calling thread. */
+	virtual bool GenerateAll(const std::vector<const google::protobuf::FileDescriptor*>& Files,
+		const std::string& Parameter,
+		google::protobuf::compiler::GeneratorContext* Context,
+		std::string* Error) const override;
+
 private:
+	struct FGeneratedFile
+	{
+		std::string BaseName;
+		std::string Header;
+		std::string Source;
+	};
+
+	bool RenderFile(const google::protobuf::FileDescriptor* File, const FGeneratorOptions& Options, FGeneratedFile& OutFile, std::string* Error) const;
+	static void WriteFile(google::protobuf::compiler::GeneratorContext* Context, const FGeneratedFile& InFile);
 	std::string GetFileNameWithoutExtension(const std::string& FileName) const;
 	void GenerateHeader(const google::protobuf::FileDescriptor* File, const std::string& BaseName, FGeneratorContext& Ctx, const std::vector<const google::protobuf::Descriptor*>& Messages, const FStrategyPool& Pool) const;
 	void GenerateSource(const google::protobuf::FileDescriptor* File, const std::string& BaseName, FGeneratorContext& Ctx, const std::vector<const google::protobuf::Descriptor*>& Messages, const FStrategyPool& Pool) const;